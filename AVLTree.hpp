@@ -0,0 +1,1191 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    AVLTree.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic self-balancing AVL Tree data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef AVLTree_hpp
+#define AVLTree_hpp
+
+#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <iostream>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include "NodeStorage.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @struct  AVLNode
+ * @brief   The AVLNode struct is meant to hold the element, the height of its subtree and pointers to the parent, left and right child elements.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+struct AVLNode
+{
+    // ------------- FIELDS -------------
+    T element;              /**< The element. */
+    AVLNode<T>* left;       /**< Pointer to the left child node in the tree. */
+    AVLNode<T>* right;      /**< Pointer to the right child node in the tree. */
+    AVLNode<T>* parent;     /**< Pointer to the parent node in the tree. */
+    int height;             /**< Height of the subtree rooted at this node, 1 for a leaf. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Copy Constructor. */
+    AVLNode(const T& element) : element(element), left(nullptr), right(nullptr), parent(nullptr), height(1) {}
+    /** Move Constructor. */
+    AVLNode(T&& element) : element(std::forward<T>(element)), left(nullptr), right(nullptr), parent(nullptr), height(1) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    AVLNode(EmplaceTag, Args&&... args) : element(std::forward<Args>(args)...), left(nullptr), right(nullptr), parent(nullptr), height(1) {}
+};
+
+template <typename T, typename Compare>
+class AVLTree;
+
+/**
+ * @class   AVLTreeIterator
+ * @brief   A bidirectional iterator that visits the elements of an AVL Tree in sorted order.
+ * @details The elements are only accessible as constants, since changing an element could break the order of the tree.
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ *
+ * @warning Removing an element invalidates the iterators to it. All other iterators remain valid.
+ */
+template <typename T, typename Compare>
+class AVLTreeIterator
+{
+public:
+    // -------------- TYPES -------------
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Default Constructor. */
+    AVLTreeIterator() : node(nullptr), tree(nullptr) {}
+    
+    // ----------- OPERATORS ------------
+    reference operator*() const { return node->element; }
+    pointer operator->() const { return &node->element; }
+    AVLTreeIterator& operator++()
+    {
+        if(node->right != nullptr)  // Next is the leftmost node of the right subtree.
+        {
+            node = node->right;
+            while(node->left != nullptr)
+                node = node->left;
+        }
+        else                        // Next is the first ancestor reached from its left subtree.
+        {
+            const AVLNode<T>* child = node;
+            node = node->parent;
+            while(node != nullptr && child == node->right)
+            {
+                child = node;
+                node = node->parent;
+            }
+        }
+        return *this;
+    }
+    AVLTreeIterator operator++(int)
+    {
+        AVLTreeIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    AVLTreeIterator& operator--()
+    {
+        if(node == nullptr)         // Stepping back from end() goes to the largest element.
+        {
+            node = tree->root;
+            while(node->right != nullptr)
+                node = node->right;
+        }
+        else if(node->left != nullptr)
+        {
+            node = node->left;
+            while(node->right != nullptr)
+                node = node->right;
+        }
+        else
+        {
+            const AVLNode<T>* child = node;
+            node = node->parent;
+            while(node != nullptr && child == node->left)
+            {
+                child = node;
+                node = node->parent;
+            }
+        }
+        return *this;
+    }
+    AVLTreeIterator operator--(int)
+    {
+        AVLTreeIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+    bool operator==(const AVLTreeIterator& other) const { return node == other.node; }
+    bool operator!=(const AVLTreeIterator& other) const { return node != other.node; }
+    
+private:
+    // ------------- FIELDS -------------
+    const AVLNode<T>* node;                 /**< The current node, nullptr past the largest element. */
+    const AVLTree<T, Compare>* tree;        /**< The tree the iterator belongs to. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Node Constructor. */
+    AVLTreeIterator(const AVLNode<T>* node, const AVLTree<T, Compare>* tree) : node(node), tree(tree) {}
+    
+    friend class AVLTree<T, Compare>;
+};
+
+/**
+ * @class   AVLTree
+ * @brief   A generic self-balancing AVL Tree class.
+ * @details This AVL Tree is templated to use any data type or class (typename T). The elements
+ *          are kept in sorted order and the heights of the two subtrees of every node differ by
+ *          at most one, so insert, find and remove all take O(log n) time. No duplicates allowed.
+ * @tparam T        Any data type or class.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before
+ *                  the second. Two elements are duplicates if neither goes before the other.
+ *                  std::less<T> by default.
+ *
+ * @note    When the default comparison is used, any class or data type used with this tree class
+ *          MUST implement its own operator< in order for this tree class to work correctly.
+ */
+template <typename T, typename Compare = std::less<T>>
+class AVLTree
+{
+public:
+    // -------------- TYPES -------------
+    typedef AVLTreeIterator<T, Compare> iterator;
+    typedef AVLTreeIterator<T, Compare> const_iterator;
+    
+    // ---------- CONSTRUCTORS ----------
+    AVLTree();
+    explicit AVLTree(const Compare& compare);
+    explicit AVLTree(const std::shared_ptr<NodePool<AVLNode<T>>>& sharedPool, const Compare& compare = Compare());
+    AVLTree(const AVLTree<T, Compare>& copyTree);
+    AVLTree(AVLTree<T, Compare>&& moveTree) noexcept;
+    ~AVLTree();
+    
+    // ----------- FUNCTIONS ------------
+    bool insert(const T& element);
+    bool insert(T&& element);
+    template <typename... Args>
+    bool emplace(Args&&... args);
+    bool remove(const T& element);
+    void clear();
+    const_iterator find(const T& element) const;
+    bool contains(const T& element) const;
+    const_iterator lowerBound(const T& element) const;
+    const_iterator upperBound(const T& element) const;
+    const T& minimum() const;
+    const T& maximum() const;
+    int size() const;
+    bool empty() const;
+    std::shared_ptr<NodePool<AVLNode<T>>> getPool();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    const_iterator end() const;
+    const_iterator cend() const;
+    
+    int depth(const T& element);
+    int height(const T& element);
+    
+    void printInorder();
+    void printPreorder();
+    void printPostorder();
+    
+    // ----------- OPERATORS ------------
+    AVLTree<T, Compare>& operator=(const AVLTree& copyTree);
+    AVLTree<T, Compare>& operator=(AVLTree&& moveTree) noexcept;
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, typename Comparison>
+    friend std::ostream& operator<<(std::ostream& output, const AVLTree<Type, Comparison>& tree);
+    
+private:
+    // ------------- FIELDS -------------
+    AVLNode<T>* root;   /**< The root of the tree. */
+    int treeSize;       /**< The size of the tree. */
+    Compare compare;    /**< The comparison the tree is ordered by. */
+    NodeStorage<AVLNode<T>> nodes;  /**< Allocates every node of the tree from a shared node pool. */
+    
+    // ----------- FUNCTIONS ------------
+    bool attachNode(AVLNode<T>* newNode);
+    AVLNode<T>* findNode(const T& element) const;
+    void copyNodes(const AVLNode<T>* copyNode, AVLNode<T>* parent, AVLNode<T>** link);
+    static int nodeHeight(const AVLNode<T>* node);
+    static void updateHeight(AVLNode<T>* node);
+    void replaceChild(AVLNode<T>* parent, AVLNode<T>* oldChild, AVLNode<T>* newChild);
+    AVLNode<T>* rotateLeft(AVLNode<T>* node);
+    AVLNode<T>* rotateRight(AVLNode<T>* node);
+    void rebalance(AVLNode<T>* node);
+    void print(const AVLNode<T>* node, const char& printOrder);
+    void swap(AVLTree<T, Compare>& other);
+    
+    friend class AVLTreeIterator<T, Compare>;
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ *
+ * @details Initializes this tree object with a nullptr root and size of 0;
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree() : root(nullptr), treeSize(0), compare() {}
+
+/**
+ * @brief   Comparison Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param compare   The comparison object this tree object will order its elements with.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree(const Compare& compare) : root(nullptr), treeSize(0), compare(compare) {}
+
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Compare      The comparison the tree is ordered by.
+ * @param sharedPool    The node pool this tree object will allocate its nodes from.
+ * @param compare       The comparison object this tree object will order its elements with.
+ *
+ * @details Initializes an empty tree object that shares its node pool with every other
+ *          tree constructed from the same pool.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree(const std::shared_ptr<NodePool<AVLNode<T>>>& sharedPool, const Compare& compare) : root(nullptr), treeSize(0), compare(compare), nodes(sharedPool) {}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param copyTree  The tree whose contents will be copied into this tree object.
+ *
+ * @details The copy has the exact same shape as the copied tree, so no rebalancing is needed.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree(const AVLTree<T, Compare>& copyTree) : root(nullptr), treeSize(0), compare(copyTree.compare)
+{
+    copyNodes(copyTree.root, nullptr, &root);
+    treeSize = copyTree.treeSize;
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param moveTree  The tree whose contents will be moved into this tree object.
+ *
+ * @details Takes over the nodes of the provided tree in constant time,
+ *          without allocating. The provided tree object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree(AVLTree<T, Compare>&& moveTree) noexcept : root(nullptr), treeSize(0), compare(moveTree.compare)
+{
+    moveTree.swap(*this);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ *
+ * @details Clears the tree using clear() function.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>::~AVLTree()
+{
+    clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Inserts element into the tree at its sorted position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element you want to add to the tree.
+ * @return          True if the element was added, false if it is a duplicate.
+ *
+ * @details No duplicates allowed.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::insert(const T& element)
+{
+    return emplace(element);
+}
+
+/**
+ * @brief   Moves element into the tree at its sorted position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element you want to move into the tree.
+ * @return          True if the element was added, false if it is a duplicate.
+ *
+ * @details No duplicates allowed.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::insert(T&& element)
+{
+    return emplace(std::move(element));
+}
+
+/**
+ * @brief   Constructs element in place and inserts it into the tree at its sorted position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the element.
+ * @return          True if the element was added, false if it is a duplicate.
+ *
+ * @details No duplicates allowed, a duplicate element is destroyed again.
+ */
+template <typename T, typename Compare>
+template <typename... Args>
+bool AVLTree<T, Compare>::emplace(Args&&... args)
+{
+    AVLNode<T>* newNode = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    if(!attachNode(newNode))
+    {
+        nodes.destroy(newNode);
+        return false;
+    }
+    
+    treeSize++;
+    rebalance(newNode->parent);
+    return true;
+}
+
+/**
+ * @brief   Removes the specified element from the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element to be removed from the tree.
+ * @return          True if the element was removed, false if it is not in the tree.
+ *
+ * @details The node is unlinked instead of overwritten, so iterators to all other elements stay valid.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::remove(const T& element)
+{
+    AVLNode<T>* deleteNode = findNode(element);
+    if(deleteNode == nullptr)   // If element doesn't exist in the tree.
+        return false;
+    
+    AVLNode<T>* rebalanceNode;  // The lowest node whose subtree changed.
+    if(deleteNode->left == nullptr || deleteNode->right == nullptr)
+    {
+        AVLNode<T>* child = (deleteNode->left != nullptr) ? deleteNode->left : deleteNode->right;
+        rebalanceNode = deleteNode->parent;
+        replaceChild(deleteNode->parent, deleteNode, child);
+    }
+    else    // Replace the node with its successor, the leftmost node of the right subtree.
+    {
+        AVLNode<T>* successor = deleteNode->right;
+        while(successor->left != nullptr)
+            successor = successor->left;
+        
+        if(successor->parent != deleteNode)
+        {
+            rebalanceNode = successor->parent;
+            replaceChild(successor->parent, successor, successor->right);
+            successor->right = deleteNode->right;
+            successor->right->parent = successor;
+        }
+        else
+            rebalanceNode = successor;
+        
+        replaceChild(deleteNode->parent, deleteNode, successor);
+        successor->left = deleteNode->left;
+        successor->left->parent = successor;
+        successor->height = deleteNode->height;
+    }
+    
+    nodes.destroy(deleteNode);
+    treeSize--;
+    rebalance(rebalanceNode);
+    return true;
+}
+
+/**
+ * @brief   Clears the entire tree and resets all field elements to default.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ *
+ * @details Tears the tree down without recursion and with constant extra space, see
+ *          NodeStorage::destroyTree(). If this tree is the only user of its node pool, the whole
+ *          pool is released at once, and the walk is skipped entirely when the elements are
+ *          trivially destructible. Otherwise every node is given back to the shared pool for reuse.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::clear()
+{
+    nodes.destroyTree(root);
+    
+    root = nullptr;
+    treeSize = 0;
+}
+
+/**
+ * @brief   Finds the specified element in the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element being searched for in the tree.
+ * @return          An iterator to the element, or end() if the element is not in the tree.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::find(const T& element) const
+{
+    return const_iterator(findNode(element), this);
+}
+
+/**
+ * @brief   Returns true if the element is in the tree, otherwise returns false.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::contains(const T& element) const
+{
+    return findNode(element) != nullptr;
+}
+
+/**
+ * @brief   Finds the smallest element that does not go before the specified element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element to compare against.
+ * @return          An iterator to the found element, or end() if every element goes before the specified element.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::lowerBound(const T& element) const
+{
+    const AVLNode<T>* bound = nullptr;
+    const AVLNode<T>* node = root;
+    while(node != nullptr)
+    {
+        if(compare(node->element, element))
+            node = node->right;
+        else
+        {
+            bound = node;
+            node = node->left;
+        }
+    }
+    
+    return const_iterator(bound, this);
+}
+
+/**
+ * @brief   Finds the smallest element that goes after the specified element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element to compare against.
+ * @return          An iterator to the found element, or end() if no element goes after the specified element.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::upperBound(const T& element) const
+{
+    const AVLNode<T>* bound = nullptr;
+    const AVLNode<T>* node = root;
+    while(node != nullptr)
+    {
+        if(compare(element, node->element))
+        {
+            bound = node;
+            node = node->left;
+        }
+        else
+            node = node->right;
+    }
+    
+    return const_iterator(bound, this);
+}
+
+/**
+ * @brief   Returns the smallest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          A constant reference to the smallest element.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the tree is empty when function is called.
+ */
+template <typename T, typename Compare>
+const T& AVLTree<T, Compare>::minimum() const
+{
+    if(root == nullptr)
+        throw std::out_of_range("Tree is Empty");
+    
+    return *begin();
+}
+
+/**
+ * @brief   Returns the largest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          A constant reference to the largest element.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the tree is empty when function is called.
+ */
+template <typename T, typename Compare>
+const T& AVLTree<T, Compare>::maximum() const
+{
+    if(root == nullptr)
+        throw std::out_of_range("Tree is Empty");
+    
+    return *(--end());
+}
+
+/**
+ * @brief   Returns the size of/number of nodes in the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          The size of the tree.
+ */
+template <typename T, typename Compare>
+int AVLTree<T, Compare>::size() const
+{
+    return treeSize;
+}
+
+/**
+ * @brief   Returns true if the tree is empty and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          A boolean flag.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::empty() const
+{
+    return treeSize == 0;
+}
+
+/**
+ * @brief   Returns the node pool used by this tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          The shared node pool.
+ *
+ * @details The returned pool can be passed to the Shared Pool Constructor of another tree
+ *          so both trees allocate from, and recycle into, the same pool.
+ */
+template <typename T, typename Compare>
+std::shared_ptr<NodePool<AVLNode<T>>> AVLTree<T, Compare>::getPool()
+{
+    return nodes.getPool();
+}
+
+/**
+ * @brief   Returns an iterator to the smallest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          An iterator to the smallest element, or end() if the tree is empty.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::begin() const
+{
+    const AVLNode<T>* node = root;
+    while(node != nullptr && node->left != nullptr)
+        node = node->left;
+    
+    return const_iterator(node, this);
+}
+
+/**
+ * @brief   Returns an iterator to the smallest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          An iterator to the smallest element, or cend() if the tree is empty.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief   Returns an iterator past the largest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          An iterator past the largest element.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::end() const
+{
+    return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief   Returns an iterator past the largest element of the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @return          An iterator past the largest element.
+ */
+template <typename T, typename Compare>
+typename AVLTree<T, Compare>::const_iterator AVLTree<T, Compare>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief   Returns depth of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element whose depth we are calculating.
+ * @return          Depth of element, or -1 if the element is not in the tree.
+ */
+template <typename T, typename Compare>
+int AVLTree<T, Compare>::depth(const T& element)
+{
+    int depth = 0;
+    const AVLNode<T>* node = root;
+    while(node != nullptr)
+    {
+        if(compare(element, node->element))
+            node = node->left;
+        else if(compare(node->element, element))
+            node = node->right;
+        else
+            return depth;
+        
+        depth++;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief   Returns height of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element whose height we are calculating.
+ * @return          Height of element, or -1 if the element is not in the tree.
+ *
+ * @details Every node keeps the height of its subtree, so no traversal is needed.
+ */
+template <typename T, typename Compare>
+int AVLTree<T, Compare>::height(const T& element)
+{
+    const AVLNode<T>* node = findNode(element);
+    return (node == nullptr) ? -1 : node->height - 1;
+}
+
+/**
+ * @brief   Prints tree Inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::printInorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    print(root, 'i');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::printPreorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    print(root, 'r');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::printPostorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    print(root, 'o');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Attaches a node to the tree as a leaf at its sorted position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param newNode   The node to attach to the tree.
+ * @return          True if the node was attached, false if its element is a duplicate.
+ */
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::attachNode(AVLNode<T>* newNode)
+{
+    AVLNode<T>* parent = nullptr;
+    AVLNode<T>** link = &root;
+    while(*link != nullptr)
+    {
+        parent = *link;
+        if(compare(newNode->element, parent->element))
+            link = &parent->left;
+        else if(compare(parent->element, newNode->element))
+            link = &parent->right;
+        else    // Element is a duplicate.
+            return false;
+    }
+    
+    newNode->parent = parent;
+    *link = newNode;
+    return true;
+}
+
+/**
+ * @brief   Finds the node that holds the specified element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param element   The element being searched for in the tree.
+ * @return          The node holding the element, or nullptr if the element is not in the tree.
+ */
+template <typename T, typename Compare>
+AVLNode<T>* AVLTree<T, Compare>::findNode(const T& element) const
+{
+    AVLNode<T>* node = root;
+    while(node != nullptr)
+    {
+        if(compare(element, node->element))
+            node = node->left;
+        else if(compare(node->element, element))
+            node = node->right;
+        else
+            return node;
+    }
+    
+    return nullptr;
+}
+
+/**
+ * @brief   Copies a subtree of another tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param copyNode  The root of the subtree to copy.
+ * @param parent    The node the copied subtree is attached to.
+ * @param link      The child pointer of the parent that receives the copied subtree.
+ *
+ * @details The tree is balanced, so the recursion never goes deeper than about 1.44 log(n).
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::copyNodes(const AVLNode<T>* copyNode, AVLNode<T>* parent, AVLNode<T>** link)
+{
+    if(copyNode == nullptr)
+        return;
+    
+    AVLNode<T>* node = nodes.create(copyNode->element);
+    node->parent = parent;
+    node->height = copyNode->height;
+    *link = node;
+    
+    copyNodes(copyNode->left, node, &node->left);
+    copyNodes(copyNode->right, node, &node->right);
+}
+
+/**
+ * @brief   Returns the height of a subtree, 0 for an empty subtree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param node      The root of the subtree.
+ * @return          The height of the subtree.
+ */
+template <typename T, typename Compare>
+int AVLTree<T, Compare>::nodeHeight(const AVLNode<T>* node)
+{
+    return (node == nullptr) ? 0 : node->height;
+}
+
+/**
+ * @brief   Recalculates the height of a node from the heights of its children.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param node      The node whose height is recalculated.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::updateHeight(AVLNode<T>* node)
+{
+    int leftHeight = nodeHeight(node->left);
+    int rightHeight = nodeHeight(node->right);
+    node->height = 1 + ((leftHeight < rightHeight) ? rightHeight : leftHeight);
+}
+
+/**
+ * @brief   Replaces a child of a node, or the root when the node is nullptr.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param parent    The parent of the old child.
+ * @param oldChild  The child that is replaced.
+ * @param newChild  The node that takes the place of the old child. May be nullptr.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::replaceChild(AVLNode<T>* parent, AVLNode<T>* oldChild, AVLNode<T>* newChild)
+{
+    if(parent == nullptr)
+        root = newChild;
+    else if(parent->left == oldChild)
+        parent->left = newChild;
+    else
+        parent->right = newChild;
+    
+    if(newChild != nullptr)
+        newChild->parent = parent;
+}
+
+/**
+ * @brief   Rotates a subtree to the left, so the right child of the node becomes its parent.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param node      The root of the subtree.
+ * @return          The new root of the subtree.
+ */
+template <typename T, typename Compare>
+AVLNode<T>* AVLTree<T, Compare>::rotateLeft(AVLNode<T>* node)
+{
+    AVLNode<T>* rightChild = node->right;
+    replaceChild(node->parent, node, rightChild);
+    
+    node->right = rightChild->left;
+    if(node->right != nullptr)
+        node->right->parent = node;
+    
+    rightChild->left = node;
+    node->parent = rightChild;
+    
+    updateHeight(node);
+    updateHeight(rightChild);
+    return rightChild;
+}
+
+/**
+ * @brief   Rotates a subtree to the right, so the left child of the node becomes its parent.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param node      The root of the subtree.
+ * @return          The new root of the subtree.
+ */
+template <typename T, typename Compare>
+AVLNode<T>* AVLTree<T, Compare>::rotateRight(AVLNode<T>* node)
+{
+    AVLNode<T>* leftChild = node->left;
+    replaceChild(node->parent, node, leftChild);
+    
+    node->left = leftChild->right;
+    if(node->left != nullptr)
+        node->left->parent = node;
+    
+    leftChild->right = node;
+    node->parent = leftChild;
+    
+    updateHeight(node);
+    updateHeight(leftChild);
+    return leftChild;
+}
+
+/**
+ * @brief   Restores the balance of every node from the specified node up to the root.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param node      The lowest node whose subtree changed.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::rebalance(AVLNode<T>* node)
+{
+    while(node != nullptr)
+    {
+        updateHeight(node);
+        int balance = nodeHeight(node->left) - nodeHeight(node->right);
+        
+        if(balance > 1)         // Left subtree is too high.
+        {
+            if(nodeHeight(node->left->left) < nodeHeight(node->left->right))
+                rotateLeft(node->left);
+            node = rotateRight(node);
+        }
+        else if(balance < -1)   // Right subtree is too high.
+        {
+            if(nodeHeight(node->right->right) < nodeHeight(node->right->left))
+                rotateRight(node->right);
+            node = rotateLeft(node);
+        }
+        
+        node = node->parent;
+    }
+}
+
+/**
+ * @brief   Prints the tree.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Compare      The comparison the tree is ordered by.
+ * @param node          The root element in the tree.
+ * @param printOrder    The order in which to print the tree (In-, Pre-, Post- order).
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::print(const AVLNode<T>* node, const char& printOrder)
+{
+    if(node == nullptr)
+        return;
+    
+    switch (printOrder)
+    {
+        case 'i':   // Inorder
+            print(node->left, printOrder);
+            if (node->left && node->right)
+                std::cout << ", " << node->element << ", ";
+            else if(node->left)
+                std::cout << ", " << node->element;
+            else if(node->right)
+                std::cout << node->element << ", ";
+            else
+                std::cout << node->element;
+            print(node->right, printOrder);
+            break;
+        case 'r':   // Preorder
+            std::cout << node->element;
+            if (node->left && node->right)
+            {
+                std::cout << ", ";
+                print(node->left, printOrder);
+                std::cout << ", ";
+                print(node->right, printOrder);
+            }
+            else if(node->left)
+            {
+                std::cout << ", ";
+                print(node->left, printOrder);
+            }
+            else if(node->right)
+            {
+                std::cout  << ", ";
+                print(node->right, printOrder);
+            }
+            break;
+        case 'o':   // Postorder
+            if (node->left && node->right)
+            {
+                print(node->left, printOrder);
+                std::cout << ", ";
+                print(node->right, printOrder);
+                std::cout << ", ";
+            }
+            else if(node->left)
+            {
+                print(node->left, printOrder);
+                std::cout << ", ";
+            }
+            else if(node->right)
+            {
+                print(node->right, printOrder);
+                std::cout  << ", ";
+            }
+            std::cout << node->element;
+            break;
+    }
+}
+
+/**
+ * @brief   Swaps Trees.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param other     The other tree with which to swap elements.
+ */
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::swap(AVLTree<T, Compare>& other)
+{
+    AVLNode<T>* tempRoot = root;
+    root = other.root;
+    other.root = tempRoot;
+    
+    int tempSize = treeSize;
+    treeSize = other.treeSize;
+    other.treeSize = tempSize;
+    
+    std::swap(compare, other.compare);
+    nodes.swap(other.nodes);
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param copyTree  The tree object from which to copy elements.
+ * @return          A reference to a copied tree object.
+ *
+ * @details Copies a tree with the help of the copy constructor and a custom swap function.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>& AVLTree<T, Compare>::operator=(const AVLTree& copyTree)
+{
+    AVLTree<T, Compare> tempTree(copyTree);
+    tempTree.swap(*this);
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param moveTree  The tree object from which to move elements.
+ * @return          A reference to a moved tree object.
+ *
+ * @details Moves tree elements from the provided tree into this tree object.
+ *          The provided tree object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, typename Compare>
+AVLTree<T, Compare>& AVLTree<T, Compare>::operator=(AVLTree&& moveTree) noexcept
+{
+    if(this == &moveTree)   // Make sure this and moveTree are not the same object.
+        return *this;
+    
+    this->clear();
+    moveTree.swap(*this);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  The comparison the tree is ordered by.
+ * @param output    The output stream (usually std::cout).
+ * @param tree      The tree object that will be printed.
+ *
+ * @details Prints the tree elements to the specified output stream in sorted order.
+ *
+ * @note    Any class or data type used with this tree class MUST implement its own
+ *          operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this tree class NEEDS to implement its own operator<<.
+ */
+template <typename T, typename Compare>
+std::ostream& operator<<(std::ostream& output, const AVLTree<T, Compare>& tree)
+{
+    if(tree.root == nullptr)
+        return output << "()";
+    
+    output << "[root: " << tree.root->element << "]\t" << "(";
+    for(typename AVLTree<T, Compare>::const_iterator it = tree.begin(); it != tree.end(); ++it)
+    {
+        if(it != tree.begin())
+            output << ", ";
+        output << *it;
+    }
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* AVLTree_hpp */
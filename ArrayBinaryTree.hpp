@@ -0,0 +1,681 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ArrayBinaryTree.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic array based Binary Tree data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ArrayBinaryTree_hpp
+#define ArrayBinaryTree_hpp
+
+#include <vector>
+#include <utility>
+#include <iostream>
+#include "SimdSearch.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   ArrayBinaryTree
+ * @brief   A generic array based Binary Tree class.
+ * @details This Binary Tree is templated to use any data type or class (typename T). It behaves
+ *          exactly like BinaryTree, which always stays a complete tree filled in level order,
+ *          but stores the elements in one contiguous array instead of linked nodes. The children
+ *          of the element at index i are at indices 2i+1 and 2i+2 and its parent is at (i-1)/2,
+ *          so no child pointers are stored at all, searches are linear scans over the array
+ *          and invertTree() only flips which of the two indices is the left child.
+ * @tparam T    Any data type or class.
+ *
+ * @note    Any class or data type used with this tree class MUST implement its own
+ *          Relational Operators (<, >, <=, >=, ==, !=) in order for this tree class to
+ *          work correctly. All primitive data types (int, float, double, char, string, bool)
+ *          already have this operator functionality, so no implementation for them
+ *          is needed. But any custom class that is used with this tree class NEEDS
+ *          to implement its own Relational Operators.
+ */
+template <typename T>
+class ArrayBinaryTree
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    ArrayBinaryTree();
+    ArrayBinaryTree(const ArrayBinaryTree<T>& copyTree);
+    ArrayBinaryTree(ArrayBinaryTree<T>&& moveTree) noexcept;
+    ~ArrayBinaryTree();
+    
+    // ----------- FUNCTIONS ------------
+    void insert(const T& element);
+    void insert(T&& element);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    bool bfsearch(const T& element);
+    bool dfsearch(const T& element);
+    void remove(const T& element);
+    void clear();
+    int size() const;
+    bool empty() const;
+    void reserve(const int capacity);
+    
+    int depth(const T& element);
+    int height(const T& element);
+    void invertTree();
+    
+    void printInorder();
+    void printPreorder();
+    void printPostorder();
+    
+    // ----------- OPERATORS ------------
+    ArrayBinaryTree<T>& operator=(const ArrayBinaryTree& copyTree);
+    ArrayBinaryTree<T>& operator=(ArrayBinaryTree&& moveTree) noexcept;
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type>
+    friend std::ostream& operator<<(std::ostream& output, const ArrayBinaryTree<Type>& tree);
+    
+private:
+    // ------------- FIELDS -------------
+    std::vector<T> elements;    /**< The elements in level order, as if the tree was never inverted. */
+    bool inverted;              /**< True if the tree is mirrored, so every level fills from right to left. */
+    
+    // ----------- FUNCTIONS ------------
+    int indexOf(const T& element) const;
+    int leftChild(const int index) const;
+    int rightChild(const int index) const;
+    int inorderFirst(int index) const;
+    int inorderNext(int index) const;
+    void print(const int index, const char& printOrder);
+    void swap(ArrayBinaryTree<T>& other);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Initializes this tree object with no elements.
+ */
+template <typename T>
+ArrayBinaryTree<T>::ArrayBinaryTree() : inverted(false) {}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param copyTree  The tree whose contents will be copied into this tree object.
+ */
+template <typename T>
+ArrayBinaryTree<T>::ArrayBinaryTree(const ArrayBinaryTree<T>& copyTree) : elements(copyTree.elements), inverted(copyTree.inverted) {}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param moveTree  The tree whose contents will be moved into this tree object.
+ *
+ * @details Takes over the array of the provided tree in constant time,
+ *          without allocating. The provided tree object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T>
+ArrayBinaryTree<T>::ArrayBinaryTree(ArrayBinaryTree<T>&& moveTree) noexcept : inverted(false)
+{
+    moveTree.swap(*this);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Clears the tree using clear() function.
+ */
+template <typename T>
+ArrayBinaryTree<T>::~ArrayBinaryTree()
+{
+    clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Inserts element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element you want to add to the tree.
+ *
+ * @details Breadth First insertion. No duplicates allowed.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::insert(const T& element)
+{
+    if(indexOf(element) == -1)
+        elements.push_back(element);
+}
+
+/**
+ * @brief   Moves element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element you want to move into the tree.
+ *
+ * @details Breadth First insertion. No duplicates allowed.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::insert(T&& element)
+{
+    if(indexOf(element) == -1)
+        elements.push_back(std::move(element));
+}
+
+/**
+ * @brief   Constructs element in place and inserts it into the tree in level order, at first available position.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ *
+ * @details Breadth First insertion. No duplicates allowed, a duplicate element is destroyed again.
+ *          The first available position is always the end of the array.
+ */
+template <typename T>
+template <typename... Args>
+void ArrayBinaryTree<T>::emplace(Args&&... args)
+{
+    elements.emplace_back(std::forward<Args>(args)...);
+    if(indexOf(elements.back()) != (int)elements.size() - 1)    // Element is a duplicate.
+        elements.pop_back();
+}
+
+/**
+ * @brief   Breadth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the tree, otherwise returns false.
+ *          The array already is in level order, so this is a linear scan.
+ */
+template <typename T>
+bool ArrayBinaryTree<T>::bfsearch(const T& element)
+{
+    return indexOf(element) != -1;
+}
+
+/**
+ * @brief   Depth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the tree, otherwise returns false.
+ *
+ * @note    This Depth First Search uses inorder traversal. It moves between parent and child
+ *          indices, so it needs no stack.
+ */
+template <typename T>
+bool ArrayBinaryTree<T>::dfsearch(const T& element)
+{
+    if(elements.empty())
+        return false;
+    
+    for(int index = inorderFirst(0); index != -1; index = inorderNext(index))
+        if(elements[index] == element)
+            return true;
+    
+    return false;
+}
+
+/**
+ * @brief   Removes the specified element from the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element to be removed from the tree.
+ *
+ * @details The element is overwritten with the deepest element, which is always the last element of the array.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::remove(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // If element doesn't exist in the tree.
+        return;
+    
+    if(index != (int)elements.size() - 1)
+        elements[index] = std::move(elements.back());
+    elements.pop_back();
+    
+    if(elements.empty())
+        inverted = false;
+}
+
+/**
+ * @brief   Clears the entire tree and resets all field elements to default.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @note    The array keeps its capacity, call reserve() on a new tree to control it.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::clear()
+{
+    elements.clear();
+    inverted = false;
+}
+
+/**
+ * @brief   Returns the size of/number of elements in the tree.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The size of the tree.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::size() const
+{
+    return (int)elements.size();
+}
+
+/**
+ * @brief   Returns true if the tree is empty and false otherwise.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A boolean flag.
+ */
+template <typename T>
+bool ArrayBinaryTree<T>::empty() const
+{
+    return elements.empty();
+}
+
+/**
+ * @brief   Makes room for at least the specified number of elements.
+ *
+ * @tparam T        Any data type or class.
+ * @param capacity  The number of elements the tree should hold without reallocating.
+ *
+ * @details Useful before bulk loading a tree, so the array is allocated only once.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::reserve(const int capacity)
+{
+    if(capacity > 0)
+        elements.reserve(capacity);
+}
+
+/**
+ * @brief   Returns depth of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose depth we are calculating.
+ * @return          Depth of element.
+ *
+ * @details The depth of the element at index i is floor(log2(i+1)).
+ */
+template <typename T>
+int ArrayBinaryTree<T>::depth(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // Tree is empty or element was not found.
+        return -1;
+    
+    int depth = 0;
+    for(int position = index + 1; position > 1; position /= 2)
+        depth++;
+    
+    return depth;
+}
+
+/**
+ * @brief   Returns height of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose height we are calculating.
+ * @return          Height of element.
+ *
+ * @details In a complete tree the deepest path below an element always starts by going
+ *          to the first filled child, so the height is the number of those steps.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::height(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // Tree is empty or element was not found.
+        return -1;
+    
+    int height = 0;
+    for(int child = 2*index + 1; child < (int)elements.size(); child = 2*child + 1)
+        height++;
+    
+    return height;
+}
+
+/**
+ * @brief   Inverts the tree.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details The elements stay where they are, only the meaning of the two child indices is swapped.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::invertTree()
+{
+    if(!elements.empty())
+        inverted = !inverted;
+}
+
+/**
+ * @brief   Prints tree Inorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::printInorder()
+{
+    if(elements.empty())
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << elements[0] << "]\t" << "(";
+    print(0, 'i');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Preorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::printPreorder()
+{
+    if(elements.empty())
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << elements[0] << "]\t" << "(";
+    print(0, 'r');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Postorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::printPostorder()
+{
+    if(elements.empty())
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << elements[0] << "]\t" << "(";
+    print(0, 'o');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Returns the index of the specified element.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          The index of the element, or -1 if the element is not in the tree.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::indexOf(const T& element) const
+{
+    return SimdSearch::find(elements.data(), (int)elements.size(), element);
+}
+
+/**
+ * @brief   Returns the index of the left child of an element.
+ *
+ * @tparam T    Any data type or class.
+ * @param index The index of the element.
+ * @return      The index of the left child, or -1 if there is no left child.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::leftChild(const int index) const
+{
+    int child = inverted ? 2*index + 2 : 2*index + 1;
+    return (child < (int)elements.size()) ? child : -1;
+}
+
+/**
+ * @brief   Returns the index of the right child of an element.
+ *
+ * @tparam T    Any data type or class.
+ * @param index The index of the element.
+ * @return      The index of the right child, or -1 if there is no right child.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::rightChild(const int index) const
+{
+    int child = inverted ? 2*index + 1 : 2*index + 2;
+    return (child < (int)elements.size()) ? child : -1;
+}
+
+/**
+ * @brief   Returns the first element of a subtree in inorder.
+ *
+ * @tparam T    Any data type or class.
+ * @param index The index of the root of the subtree.
+ * @return      The index of the leftmost element of the subtree.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::inorderFirst(int index) const
+{
+    for(int child = leftChild(index); child != -1; child = leftChild(index))
+        index = child;
+    
+    return index;
+}
+
+/**
+ * @brief   Returns the element that follows an element in inorder.
+ *
+ * @tparam T    Any data type or class.
+ * @param index The index of the current element.
+ * @return      The index of the next element, or -1 if the current element is the last one.
+ */
+template <typename T>
+int ArrayBinaryTree<T>::inorderNext(int index) const
+{
+    int child = rightChild(index);
+    if(child != -1)
+        return inorderFirst(child);
+    
+    // Climb until we come up from a left subtree.
+    while(index != 0)
+    {
+        int parent = (index - 1) / 2;
+        if(leftChild(parent) == index)
+            return parent;
+        index = parent;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief   Prints the binary tree.
+ *
+ * @tparam T            Any data type or class.
+ * @param index         The index of the root element in the tree.
+ * @param printOrder    The order in which to print the tree (In-, Pre-, Post- order).
+ *
+ * @details The tree is complete, so the recursion never goes deeper than log2(n).
+ */
+template <typename T>
+void ArrayBinaryTree<T>::print(const int index, const char& printOrder)
+{
+    if(index == -1)
+        return;
+    
+    int left = leftChild(index);
+    int right = rightChild(index);
+    switch (printOrder)
+    {
+        case 'i':   // Inorder
+            print(left, printOrder);
+            if (left != -1 && right != -1)
+                std::cout << ", " << elements[index] << ", ";
+            else if(left != -1)
+                std::cout << ", " << elements[index];
+            else if(right != -1)
+                std::cout << elements[index] << ", ";
+            else
+                std::cout << elements[index];
+            print(right, printOrder);
+            break;
+        case 'r':   // Preorder
+            std::cout << elements[index];
+            if(left != -1)
+            {
+                std::cout << ", ";
+                print(left, printOrder);
+            }
+            if(right != -1)
+            {
+                std::cout << ", ";
+                print(right, printOrder);
+            }
+            break;
+        case 'o':   // Postorder
+            if(left != -1)
+            {
+                print(left, printOrder);
+                std::cout << ", ";
+            }
+            if(right != -1)
+            {
+                print(right, printOrder);
+                std::cout << ", ";
+            }
+            std::cout << elements[index];
+            break;
+    }
+}
+
+/**
+ * @brief   Swaps Trees.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The other tree with which to swap elements.
+ */
+template <typename T>
+void ArrayBinaryTree<T>::swap(ArrayBinaryTree<T>& other)
+{
+    elements.swap(other.elements);
+    
+    bool tempInverted = inverted;
+    inverted = other.inverted;
+    other.inverted = tempInverted;
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @param copyTree  The tree object from which to copy elements.
+ * @return          A reference to a copied tree object.
+ *
+ * @details Copies a tree with the help of the copy constructor and a custom swap function.
+ */
+template <typename T>
+ArrayBinaryTree<T>& ArrayBinaryTree<T>::operator=(const ArrayBinaryTree& copyTree)
+{
+    ArrayBinaryTree<T> tempTree(copyTree);
+    tempTree.swap(*this);
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @param moveTree  The tree object from which to move elements.
+ * @return          A reference to a moved tree object.
+ *
+ * @details Moves tree elements from the provided tree into this tree object.
+ *          The provided tree object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T>
+ArrayBinaryTree<T>& ArrayBinaryTree<T>::operator=(ArrayBinaryTree&& moveTree) noexcept
+{
+    if(this == &moveTree)   // Make sure this and moveTree are not the same object.
+        return *this;
+    
+    this->clear();
+    moveTree.swap(*this);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T        Any data type or class.
+ * @param output    The output stream (usually std::cout).
+ * @param tree      The tree object that will be printed.
+ *
+ * @details Prints the tree elements to the specified output stream using inorder traversal.
+ *
+ * @note    Any class or data type used with this tree class MUST implement its own
+ *          operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this tree class NEEDS to implement its own operator<<.
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& output, const ArrayBinaryTree<T>& tree)
+{
+    if(tree.elements.empty())
+        return output << "()";
+    
+    int first = tree.inorderFirst(0);
+    output << "[root: " << tree.elements[0] << "]\t" << "(" << tree.elements[first];
+    for(int index = tree.inorderNext(first); index != -1; index = tree.inorderNext(index))
+        output << ", " << tree.elements[index];
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* ArrayBinaryTree_hpp */
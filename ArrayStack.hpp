@@ -0,0 +1,635 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ArrayStack.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic contiguous (array backed) Stack data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ArrayStack_hpp
+#define ArrayStack_hpp
+
+#include <new>
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include "SimdSearch.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   ArrayStack
+ * @brief   A generic array backed Stack class.
+ * @details This Stack class is templated to use any data type or class. The elements are stored
+ *          in one contiguous array that grows geometrically, so pushing and popping an element
+ *          does not allocate a node and does not chase pointers. It has the same interface
+ *          as Stack, so the two can be swapped for one another.
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself before the
+ *                          stack moves its elements to the heap (small-buffer mode). Zero by default.
+ */
+template <typename T, int InlineCapacity = 0>
+class ArrayStack
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    ArrayStack();
+    ArrayStack(const ArrayStack<T, InlineCapacity>& copyStack);
+    ArrayStack(ArrayStack<T, InlineCapacity>&& moveStack) noexcept;
+    ~ArrayStack();
+    
+    // ----------- FUNCTIONS ------------
+    void push(const T& data);
+    void push(T&& data);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    T pop();
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    int size() const;
+    bool empty() const;
+    bool contains(const T& element) const;
+    void clear();
+    int capacity() const;
+    void reserve(const int newCapacity);
+    void shrinkToFit();
+    
+    // ----------- OPERATORS ------------
+    bool operator==(const ArrayStack& compareStack) const;
+    ArrayStack<T, InlineCapacity>& operator=(const ArrayStack& copyStack);
+    ArrayStack<T, InlineCapacity>& operator=(ArrayStack&& moveStack) noexcept;
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, int Capacity>
+    friend std::ostream& operator<<(std::ostream& output, const ArrayStack<Type, Capacity>& stack);
+    
+private:
+    // ------------- FIELDS -------------
+    T* elements;        /**< The bottom of the stack. Points at either the inline buffer or the heap. */
+    int stackSize;      /**< The size of the stack. */
+    int stackCapacity;  /**< Number of elements that fit in the current storage. */
+    alignas(T) unsigned char inlineBuffer[InlineCapacity > 0 ? InlineCapacity * sizeof(T) : 1];  /**< Inline storage. */
+    
+    // ----------- FUNCTIONS ------------
+    T* inlineElements();
+    bool usesInlineBuffer() const;
+    void reallocate(const int newCapacity);
+    void moveFrom(ArrayStack<T, InlineCapacity>& other);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ *
+ * @details Initializes this stack object with a size of 0. Only the inline buffer is
+ *          available until the first push that does not fit into it.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>::ArrayStack() : elements(nullptr), stackSize(0), stackCapacity(InlineCapacity)
+{
+    if(InlineCapacity > 0)
+        elements = inlineElements();
+}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param copyStack         The stack whose elements will be copied into this stack object.
+ *
+ * @details Allocates the storage once, with exactly the capacity needed for the copied elements.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>::ArrayStack(const ArrayStack<T, InlineCapacity>& copyStack) : ArrayStack()
+{
+    reserve(copyStack.stackSize);
+    for(int i = 0; i < copyStack.stackSize; i++)
+    {
+        new (elements + i) T(copyStack.elements[i]);
+        stackSize++;
+    }
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param moveStack         The stack whose elements will be moved into this stack object.
+ *
+ * @details Takes over the heap storage of the provided stack in constant time. Elements held in the
+ *          inline buffer are moved one by one. The provided stack object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>::ArrayStack(ArrayStack<T, InlineCapacity>&& moveStack) noexcept : ArrayStack()
+{
+    moveFrom(moveStack);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ *
+ * @details Destroys the elements using clear() function and frees the heap storage.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>::~ArrayStack()
+{
+    clear();
+    if(!usesInlineBuffer())
+        ::operator delete(elements);
+}
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds element to the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param data              The element you want to add to the stack.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::push(const T& data)
+{
+    emplace(data);
+}
+
+/**
+ * @brief   Moves element to the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param data              The element you want to move into the stack.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::push(T&& data)
+{
+    emplace(std::move(data));
+}
+
+/**
+ * @brief   Constructs element in place at the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @tparam Args             The types of the constructor arguments.
+ * @param args              The arguments forwarded to the constructor of the element.
+ *
+ * @details Doubles the capacity when the stack is full.
+ */
+template <typename T, int InlineCapacity>
+template <typename... Args>
+void ArrayStack<T, InlineCapacity>::emplace(Args&&... args)
+{
+    if(stackSize == stackCapacity)
+    {
+        // Build the element first, the arguments might refer to an element of this stack.
+        T data(std::forward<Args>(args)...);
+        reallocate(stackCapacity < 4 ? 8 : stackCapacity * 2);
+        new (elements + stackSize) T(std::move(data));
+    }
+    else
+        new (elements + stackSize) T(std::forward<Args>(args)...);
+    
+    stackSize++;
+}
+
+/**
+ * @brief   Removes and returns the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  The removed element.
+ *
+ * @details The element is moved out of the stack, not copied.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int InlineCapacity>
+T ArrayStack<T, InlineCapacity>::pop()
+{
+    if(stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    T popped_data = std::move(elements[stackSize-1]);
+    elements[stackSize-1].~T();
+    stackSize--;
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes the top of the stack and moves it into the provided variable.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param out               The variable that receives the removed element.
+ * @return                  True if an element was removed, false if the stack is empty.
+ *
+ * @details Works like pop() but reports an empty stack through the return value instead of throwing.
+ */
+template <typename T, int InlineCapacity>
+bool ArrayStack<T, InlineCapacity>::tryPop(T& out)
+{
+    if(stackSize == 0)
+        return false;
+    
+    out = std::move(elements[stackSize-1]);
+    elements[stackSize-1].~T();
+    stackSize--;
+    
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  A reference to the element located at the top of the stack.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int InlineCapacity>
+T& ArrayStack<T, InlineCapacity>::peek()
+{
+    if(stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    return elements[stackSize-1];
+}
+
+/**
+ * @brief   Returns, but does not remove, the top of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  A constant reference to the element located at the top of the stack.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int InlineCapacity>
+const T& ArrayStack<T, InlineCapacity>::peek() const
+{
+    if(stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    return elements[stackSize-1];
+}
+
+/**
+ * @brief   Returns the size of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  The size of the stack.
+ */
+template <typename T, int InlineCapacity>
+int ArrayStack<T, InlineCapacity>::size() const
+{
+    return stackSize;
+}
+
+/**
+ * @brief   Returns true if the stack is empty and false otherwise.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  A boolean flag.
+ */
+template <typename T, int InlineCapacity>
+bool ArrayStack<T, InlineCapacity>::empty() const
+{
+    return stackSize == 0;
+}
+
+/**
+ * @brief   Destroys every element of the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ *
+ * @details The capacity is kept, use shrinkToFit() afterwards to give the memory back.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::clear()
+{
+    for(int i = stackSize-1; i >= 0; i--)
+        elements[i].~T();
+    
+    stackSize = 0;
+}
+
+/**
+ * @brief   Checks if an element is in the stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param element           The element being searched for in the stack.
+ * @return                  A boolean flag.
+ *
+ * @details The elements are contiguous, so integer and floating point elements are
+ *          searched with the vectorized kernels from SimdSearch.
+ */
+template <typename T, int InlineCapacity>
+bool ArrayStack<T, InlineCapacity>::contains(const T& element) const
+{
+    return SimdSearch::find(elements, stackSize, element) != -1;
+}
+
+/**
+ * @brief   Returns the number of elements the stack can hold before it has to grow.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  The capacity of the stack.
+ */
+template <typename T, int InlineCapacity>
+int ArrayStack<T, InlineCapacity>::capacity() const
+{
+    return stackCapacity;
+}
+
+/**
+ * @brief   Makes sure the stack can hold at least the specified number of elements without growing.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param newCapacity       The minimum capacity.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::reserve(const int newCapacity)
+{
+    if(newCapacity > stackCapacity)
+        reallocate(newCapacity);
+}
+
+/**
+ * @brief   Reduces the capacity of the stack to its size.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ *
+ * @details Moves the elements back into the inline buffer if they fit in it.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::shrinkToFit()
+{
+    if(!usesInlineBuffer() && stackSize < stackCapacity)
+        reallocate(stackSize);
+}
+
+/**
+ * @brief   Returns the inline buffer as an array of elements.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  A pointer to the first element of the inline buffer.
+ */
+template <typename T, int InlineCapacity>
+T* ArrayStack<T, InlineCapacity>::inlineElements()
+{
+    return reinterpret_cast<T*>(inlineBuffer);
+}
+
+/**
+ * @brief   Returns true if the elements are stored in the inline buffer (or nowhere yet).
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @return                  A boolean flag.
+ */
+template <typename T, int InlineCapacity>
+bool ArrayStack<T, InlineCapacity>::usesInlineBuffer() const
+{
+    return elements == nullptr || (InlineCapacity > 0 && elements == reinterpret_cast<const T*>(inlineBuffer));
+}
+
+/**
+ * @brief   Moves the elements into storage of the specified capacity.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param newCapacity       The new capacity. Must not be less than the size of the stack.
+ *
+ * @details Uses the inline buffer when the new capacity fits into it, otherwise the heap.
+ *          Every element is built in the new storage before any old element is destroyed,
+ *          so if a copy throws, the stack is left as it was.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::reallocate(const int newCapacity)
+{
+    T* newElements;
+    int capacityUsed = newCapacity;
+    if(newCapacity <= InlineCapacity)
+    {
+        if(usesInlineBuffer())  // Already in the inline buffer, nothing to move.
+            return;
+        
+        newElements = inlineElements();
+        capacityUsed = InlineCapacity;
+    }
+    else
+        newElements = static_cast<T*>(::operator new(sizeof(T) * newCapacity));
+    
+    int built = 0;
+    try
+    {
+        for(; built < stackSize; built++)
+            new (newElements + built) T(std::move_if_noexcept(elements[built]));
+    }
+    catch(...)  // Undo the copies made so far and keep the old storage.
+    {
+        for(int i = 0; i < built; i++)
+            newElements[i].~T();
+        if(newElements != inlineElements())
+            ::operator delete(newElements);
+        throw;
+    }
+    
+    for(int i = 0; i < stackSize; i++)
+        elements[i].~T();
+    if(!usesInlineBuffer())
+        ::operator delete(elements);
+    
+    elements = (capacityUsed == 0) ? nullptr : newElements;
+    stackCapacity = capacityUsed;
+}
+
+/**
+ * @brief   Moves the elements of another stack into this empty stack.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param other             The stack whose elements will be moved. It is empty afterwards.
+ *
+ * @details Heap storage is taken over in constant time. Elements in the inline buffer are moved one by one.
+ */
+template <typename T, int InlineCapacity>
+void ArrayStack<T, InlineCapacity>::moveFrom(ArrayStack<T, InlineCapacity>& other)
+{
+    if(other.usesInlineBuffer())
+    {
+        for(int i = 0; i < other.stackSize; i++)
+            new (elements + i) T(std::move(other.elements[i]));
+        
+        stackSize = other.stackSize;
+        other.clear();
+        return;
+    }
+    
+    elements = other.elements;
+    stackSize = other.stackSize;
+    stackCapacity = other.stackCapacity;
+    
+    other.elements = (InlineCapacity > 0) ? other.inlineElements() : nullptr;
+    other.stackSize = 0;
+    other.stackCapacity = InlineCapacity;
+}
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Compares this stack object with another stack object.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param compareStack      The stack object with which to compare this stack object.
+ * @return                  A boolean flag.
+ *
+ * @details Returns true only if the objects are either the same object or both objects
+ *          have the exact same elements in the exact same order.
+ */
+template <typename T, int InlineCapacity>
+bool ArrayStack<T, InlineCapacity>::operator==(const ArrayStack& compareStack) const
+{
+    if(this == &compareStack)
+        return true;
+    else if(stackSize != compareStack.stackSize)
+        return false;
+    
+    return SimdSearch::equal(elements, compareStack.elements, stackSize);
+}
+
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param copyStack         The stack object from which to copy elements.
+ * @return                  A reference to a copied stack object.
+ *
+ * @details Reuses the storage of this stack when it is large enough.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>& ArrayStack<T, InlineCapacity>::operator=(const ArrayStack& copyStack)
+{
+    if(this == &copyStack)  // Make sure this and copyStack are not the same object.
+        return *this;
+    
+    clear();
+    reserve(copyStack.stackSize);
+    for(int i = 0; i < copyStack.stackSize; i++)
+    {
+        new (elements + i) T(copyStack.elements[i]);
+        stackSize++;
+    }
+    
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param moveStack         The stack object from which to move elements.
+ * @return                  A reference to a moved stack object.
+ *
+ * @details Moves stack elements from the provided stack into this stack object.
+ *          The provided stack object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, int InlineCapacity>
+ArrayStack<T, InlineCapacity>& ArrayStack<T, InlineCapacity>::operator=(ArrayStack&& moveStack) noexcept
+{
+    if(this == &moveStack)  // Make sure this and moveStack are not the same object.
+        return *this;
+    
+    clear();
+    if(!usesInlineBuffer())
+        ::operator delete(elements);
+    
+    elements = (InlineCapacity > 0) ? inlineElements() : nullptr;
+    stackCapacity = InlineCapacity;
+    moveFrom(moveStack);
+    return *this;
+}
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InlineCapacity   Number of elements stored inside the stack object itself.
+ * @param output            The output stream (usually std::cout).
+ * @param stack             The stack object that will be printed.
+ *
+ * @details Prints the stack elements to the specified output stream. Prints starting from the
+ *          bottom of the stack and finishes printing at the top of the stack (BOTTOM, ... , TOP).
+ *
+ * @note    Any class or data type used with this stack class MUST implement its
+ *          own operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this stack class NEEDS to implement its own operator<<.
+ */
+template <typename T, int InlineCapacity>
+std::ostream& operator<<(std::ostream& output, const ArrayStack<T, InlineCapacity>& stack)
+{
+    output << "(";
+    for(int i = 0; i < stack.stackSize; i++)
+    {
+        if(i > 0)
+            output << ", ";
+        output << stack.elements[i];
+    }
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* ArrayStack_hpp */
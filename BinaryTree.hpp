@@ -14,49 +14,53 @@
 #ifndef BinaryTree_hpp
 #define BinaryTree_hpp
 
+#include <map>
 #include <queue>
-#include <stack>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include "NodeStorage.hpp"
+#include "Serialization.hpp"
+#include "BufferedWriter.hpp"
+#include "ParallelAlgorithms.hpp"
+
+namespace DataStructures
+{
 
 /**
- * @struct  Node
- * @brief   The Node struct is meant to hold the element and pointers to the left and right child elements.
+ * @struct  TreeNode
+ * @brief   The TreeNode struct is meant to hold the element and pointers to the left and right child elements.
  *
  * @tparam T    Any data type or class.
  */
 template <typename T>
-struct Node
+struct TreeNode
 {
     // ------------- FIELDS -------------
-    T element;      /**< The element. */
-    Node<T>* left;  /**< Pointer to the left child node in the tree. */
-    Node<T>* right; /**< Pointer to the right child node in the tree. */
+    T element;           /**< The element. */
+    TreeNode<T>* left;   /**< Pointer to the left child node in the tree. */
+    TreeNode<T>* right;  /**< Pointer to the right child node in the tree. */
     
     // ---------- CONSTRUCTORS ----------
     /** Copy Constructor. */
-    Node(const T& element) : element(element), left(nullptr), right(nullptr) {}
+    TreeNode(const T& element) : element(element), left(nullptr), right(nullptr) {}
     /** Move Constructor. */
-    Node(T&& element) : element(std::forward<T>(element)), left(nullptr), right(nullptr) {}
-    /** Struct Destructor. */
-    ~Node()
-    {
-        delete left;
-        left = nullptr;
-        delete right;
-        right = nullptr;
-    }
+    TreeNode(T&& element) : element(std::forward<T>(element)), left(nullptr), right(nullptr) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    TreeNode(EmplaceTag, Args&&... args) : element(std::forward<Args>(args)...), left(nullptr), right(nullptr) {}
     
     // ----- NON-MEMEBER OPERATORS ------
-    friend std::ostream& operator<<(std::ostream& output, const Node<T>& node)
-    {
-        if (node.left && node.right)
-            return output << *node.left << ", " << node.element << ", " << *node.right;
-        else if(node.left)
-            return output << *node.left << ", " << node.element;
-        else if(node.right)
-            return output << node.element << ", " << *node.right;
-        else
-            return output << node.element;
+    /** Prints the element of the node. The whole tree is printed by the operator<< of BinaryTree. */
+    friend std::ostream& operator<<(std::ostream& output, const TreeNode<T>& node)
+    {
+        return output << node.element;
     }
 };
 
@@ -79,50 +83,115 @@ class BinaryTree
 public:
     // ---------- CONSTRUCTORS ----------
     BinaryTree();
+    explicit BinaryTree(const std::shared_ptr<NodePool<TreeNode<T>>>& sharedPool);
+    template <typename Iterator>
+    BinaryTree(Iterator first, Iterator last);
+    BinaryTree(std::initializer_list<T> elements);
     BinaryTree(const BinaryTree<T>& copyTree);
-    BinaryTree(BinaryTree<T>&& moveTree);
+    BinaryTree(BinaryTree<T>&& moveTree) noexcept;
     ~BinaryTree();
     
     // ----------- FUNCTIONS ------------
-    void insert(const T element);
-    bool bfsearch(const T& element);
-    bool dfsearch(const T& element);
-    void remove(const T element);
+    void insert(const T& element);
+    void insert(T&& element);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    template <typename Iterator>
+    void insertBulk(Iterator first, Iterator last);
+    bool bfsearch(const T& element) const;
+    bool parallelBfsearch(const T& element) const;
+    bool dfsearch(const T& element) const;
+    void remove(const T& element);
     void clear();
-    int size();
-    bool empty();
+    template <typename Iterator>
+    void assign(Iterator first, Iterator last);
+    int size() const;
+    bool empty() const;
+    std::shared_ptr<NodePool<TreeNode<T>>> getPool();
+#if defined(DATASTRUCTURES_STATS)
+    const ContainerStats& stats();
+#endif
+    void serialize(std::ostream& output) const;
+    void deserialize(std::istream& input);
+    void serializeFlat(std::ostream& output) const;
+    void deserializeFlat(const void* data, const std::size_t bytes);
+    template <typename Sink>
+    void writeTo(Sink& sink, const char* separator = ", ", const char printOrder = 'i') const;
     
-    int depth(const T& element);
-    int height(const T& element);
+    int depth(const T& element) const;
+    int height(const T& element) const;
+    std::vector<int> depths(const std::vector<T>& elements) const;
+    std::vector<int> heights(const std::vector<T>& elements) const;
     void invertTree();
     
+    template <typename Function>
+    void forEachInorder(Function visit) const;
+    template <typename Function>
+    void forEachPreorder(Function visit) const;
+    template <typename Function>
+    void forEachPostorder(Function visit) const;
+    template <typename Function>
+    void forEach(Function visit, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Result, typename Combine>
+    Result reduce(Result init, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Result, typename Accumulate, typename Combine>
+    Result reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    const T* findIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    int removeIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy());
+    
     void printInorder();
     void printPreorder();
     void printPostorder();
     
     // ----------- OPERATORS ------------
     BinaryTree<T>& operator=(const BinaryTree& copyTree);
-    BinaryTree<T>& operator=(BinaryTree&& moveTree);
+    BinaryTree<T>& operator=(BinaryTree&& moveTree) noexcept;
     
     // ----- NON-MEMEBER OPERATORS ------
     template <typename Type>
     friend std::ostream& operator<<(std::ostream& output, const BinaryTree<Type>& tree);
     
 private:
+    /**
+     * @struct  ElementLess
+     * @brief   Orders pointers to elements by the elements they point to.
+     */
+    struct ElementLess
+    {
+        bool operator()(const T* first, const T* second) const { return *first < *second; }
+    };
+    
     // ------------- FIELDS -------------
-    Node<T>* root;  /**< The root of the tree. */
-    int treeSize;   /**< The size of the tree. */
+    TreeNode<T>* root;                                  /**< The root of the tree. */
+    int treeSize;                                       /**< The size of the tree. */
+    bool inverted;                                      /**< True if the tree is mirrored, so every level fills from right to left. */
+    std::vector<TreeNode<T>*> levelOrder;               /**< Every node in level order, as if the tree was never inverted. */
+    std::map<const T*, int, ElementLess> elementIndex;  /**< The level order position of every element, ordered by element. */
+    NodeStorage<TreeNode<T>> nodes;                     /**< Allocates every node of the tree from a shared node pool. */
+    
+    // ----------- CONSTANTS ------------
+    static const int MAX_LEVELS = 32;   /**< A complete tree of at most INT_MAX nodes has at most 31 levels. */
+    static const int PARALLEL_THRESHOLD = 1 << 16;  /**< The fewest elements that are worth splitting across threads. */
     
     // ----------- FUNCTIONS ------------
-    int getDepth(const Node<T>* current, const T& element, int depth);
-    int getHeight(const Node<T>* current, const T& element, int height, bool elementFound);
-    void invert(Node<T>* invertNode);
-    void print(const Node<T>* node, const char& printOrder);
+    void copyFrom(const BinaryTree<T>& copyTree);
+    bool attachNode(TreeNode<T>* newNode);
+    void linkNode(TreeNode<T>* newNode);
+    static int threadsFor(const int elementCount);
+    int positionOf(const T& element) const;
+    int depthAt(const int position) const;
+    int heightAt(const int position) const;
+    template <typename Visitor>
+    bool visitInorder(Visitor& visit) const;
+    template <typename Visitor>
+    bool visitPreorder(Visitor& visit) const;
+    template <typename Visitor>
+    bool visitPostorder(Visitor& visit) const;
     void swap(BinaryTree<T>& otherTree);
 };
 
-#endif /* BinaryTree_hpp */
-
 
 // **************************************************************************
 // **************************************************************************
@@ -141,48 +210,63 @@ private:
  * @details Initializes this tree object with a nullptr root and size of 0;
  */
 template <typename T>
-BinaryTree<T>::BinaryTree() : root(nullptr), treeSize(0) {}
+BinaryTree<T>::BinaryTree() : root(nullptr), treeSize(0), inverted(false) {}
+
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @param sharedPool    The node pool this tree object will allocate its nodes from.
+ *
+ * @details Initializes an empty tree object that shares its node pool with every other
+ *          tree constructed from the same pool.
+ */
+template <typename T>
+BinaryTree<T>::BinaryTree(const std::shared_ptr<NodePool<TreeNode<T>>>& sharedPool) : root(nullptr), treeSize(0), inverted(false), nodes(sharedPool) {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ *
+ * @details Initializes this tree object with the elements of the range in level order. See insertBulk().
+ */
+template <typename T>
+template <typename Iterator>
+BinaryTree<T>::BinaryTree(Iterator first, Iterator last) : BinaryTree()
+{
+    insertBulk(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param elements  The elements this tree object will hold, in level order.
+ *
+ * @details See insertBulk().
+ */
+template <typename T>
+BinaryTree<T>::BinaryTree(std::initializer_list<T> elements) : BinaryTree()
+{
+    insertBulk(elements.begin(), elements.end());
+}
 
 /**
  * @brief   Copy Constructor.
  *
  * @tparam T        Any data type or class.
  * @param copyTree  The tree whose contents will be copied into this tree object.
+ *
+ * @details Every node is reserved from the node pool with a single allocation.
  */
 template <typename T>
-BinaryTree<T>::BinaryTree(const BinaryTree<T>& copyTree) : root(nullptr), treeSize(0)
+BinaryTree<T>::BinaryTree(const BinaryTree<T>& copyTree) : root(nullptr), treeSize(0), inverted(false)
 {
-    Node<T>** currentNode;
-    std::queue<Node<T>**> treeQueue;
-    treeQueue.push(&root);
-    
-    Node<T>* copyNode;
-    std::queue<Node<T>*> copyTreeQueue;
-    copyTreeQueue.push(copyTree.root);
-    
-    while(!copyTreeQueue.empty())
-    {
-        currentNode = treeQueue.front();
-        treeQueue.pop();
-        
-        copyNode = copyTreeQueue.front();
-        copyTreeQueue.pop ();
-        
-        (*currentNode) = new Node<T>(copyNode->element);
-        
-        if(copyNode->left != nullptr)
-        {
-            treeQueue.push(&(*currentNode)->left);
-            copyTreeQueue.push(copyNode->left);
-        }
-        if(copyNode->right != nullptr)
-        {
-            treeQueue.push(&(*currentNode)->right);
-            copyTreeQueue.push(copyNode->right);
-        }
-        
-        treeSize++;
-    }
+    copyFrom(copyTree);
 }
 
 /**
@@ -191,43 +275,15 @@ BinaryTree<T>::BinaryTree(const BinaryTree<T>& copyTree) : root(nullptr), treeSi
  * @tparam T        Any data type or class.
  * @param moveTree  The tree whose contents will be moved into this tree object.
  *
+ * @details Takes over the nodes of the provided tree in constant time,
+ *          without allocating. The provided tree object is empty afterwards.
+ *
  * @note std::move() needs to be used to call this constructor.
  */
 template <typename T>
-BinaryTree<T>::BinaryTree(BinaryTree<T>&& moveTree) : root(nullptr), treeSize(0)
+BinaryTree<T>::BinaryTree(BinaryTree<T>&& moveTree) noexcept : root(nullptr), treeSize(0), inverted(false)
 {
-    Node<T>** currentNode;
-    std::queue<Node<T>**> treeQueue;
-    treeQueue.push(&root);
-    
-    Node<T>* moveNode;
-    std::queue<Node<T>*> moveTreeQueue;
-    moveTreeQueue.push(moveTree.root);
-    
-    while(!moveTreeQueue.empty())
-    {
-        currentNode = treeQueue.front();
-        treeQueue.pop();
-        
-        moveNode = moveTreeQueue.front();
-        moveTreeQueue.pop ();
-        
-        (*currentNode) = new Node<T>(std::move(moveNode->element));
-        
-        if(moveNode->left != nullptr)
-        {
-            treeQueue.push(&(*currentNode)->left);
-            moveTreeQueue.push(moveNode->left);
-        }
-        if(moveNode->right != nullptr)
-        {
-            treeQueue.push(&(*currentNode)->right);
-            moveTreeQueue.push(moveNode->right);
-        }
-        
-        treeSize++;
-    }
-    moveTree.clear();
+    moveTree.swap(*this);
 }
 
 /**
@@ -235,7 +291,7 @@ BinaryTree<T>::BinaryTree(BinaryTree<T>&& moveTree) : root(nullptr), treeSize(0)
  *
  * @tparam T    Any data type or class.
  *
- * @details Recursively clears the tree using clear() function.
+ * @details Clears the tree using clear() function.
  */
 template <typename T>
 BinaryTree<T>::~BinaryTree()
@@ -256,51 +312,143 @@ BinaryTree<T>::~BinaryTree()
  * @details Breadth First insertion. No duplicates allowed.
  */
 template <typename T>
-void BinaryTree<T>::insert(const T element)
+void BinaryTree<T>::insert(const T& element)
 {
-    if(root == nullptr)
-        root = new Node<T>(element);
-    else if(root->element == element)   // Make sure root isn't a duplicate of element.
-        return;
+    emplace(element);
+}
+
+/**
+ * @brief   Moves element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element you want to move into the tree.
+ *
+ * @details Breadth First insertion. No duplicates allowed.
+ */
+template <typename T>
+void BinaryTree<T>::insert(T&& element)
+{
+    emplace(std::move(element));
+}
+
+/**
+ * @brief   Constructs element in place and inserts it into the tree in level order, at first available position.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ *
+ * @details Breadth First insertion. No duplicates allowed, a duplicate element is destroyed again.
+ *          The first open position and the duplicate check are both looked up directly,
+ *          so no part of the tree is searched.
+ */
+template <typename T>
+template <typename... Args>
+void BinaryTree<T>::emplace(Args&&... args)
+{
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::INSERT);
+#endif
+    TreeNode<T>* newNode = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    if(attachNode(newNode))
+        treeSize++;
     else
+        nodes.destroy(newNode);
+}
+
+/**
+ * @brief   Inserts every element of a range into the tree in level order, at the first available positions.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ *
+ * @details Gives the same tree as inserting the elements one by one, a duplicate element is
+ *          skipped and only its first occurrence is inserted. Instead of looking every element up
+ *          in the element index separately, the new elements are sorted first, on several threads
+ *          for large ranges, and then added to the index in order, each one next to the one before.
+ *
+ *          When the size of the range can be counted up front, every node is reserved from the
+ *          node pool with a single allocation.
+ *
+ *          If an element or its comparison throws, the tree is left as it was before the call.
+ *
+ * @note    The nodes are still created on the calling thread, because the node pool is not thread safe.
+ */
+template <typename T>
+template <typename Iterator>
+void BinaryTree<T>::insertBulk(Iterator first, Iterator last)
+{
+    std::vector<TreeNode<T>*> newNodes;
+    int count = rangeSize(first, last);
+    if(count > 0)   // Reserve every node with one allocation.
     {
-        std::queue<Node<T>*> treeQueue;
-        treeQueue.push(root);
-        Node<T>* currentNode;
+        nodes.reserve(count);
+        newNodes.reserve(count);
+        levelOrder.reserve(levelOrder.size() + count);
+    }
+    
+    // The index entries of the new elements, or the end of the index for a duplicate.
+    std::vector<typename std::map<const T*, int, ElementLess>::iterator> entries;
+    try
+    {
+        for(; first != last; ++first)
+            newNodes.push_back(nodes.create(*first));
         
-        while(!treeQueue.empty())
+        int nodeCount = (int)newNodes.size();
+        std::vector<int> sortedOrder(nodeCount);
+        for(int i = 0; i < nodeCount; i++)
+            sortedOrder[i] = i;
+        
+        // Stable sort every segment, so the first occurrence of a duplicate is added to the index before the others.
+        auto elementLess = [&newNodes](const int firstIndex, const int secondIndex) { return newNodes[firstIndex]->element < newNodes[secondIndex]->element; };
+        int segmentCount = threadsFor(nodeCount);
+        ExecutionPolicy::parallel(segmentCount).runSegments(nodeCount, segmentCount, [&sortedOrder, &elementLess](const int, const int start, const int end)
         {
-            currentNode = treeQueue.front();
-            treeQueue.pop();
-            
-            if(currentNode->left != nullptr)
-            {
-                if(currentNode->left->element == element)  // Make sure left child isn't a duplicate of element.
-                    return;
-                else
-                    treeQueue.push(currentNode->left);
-            }
-            else
-            {
-                currentNode->left = new Node<T>(element);
-                break;
-            }
-            if(currentNode->right != nullptr)
-            {
-                if(currentNode->right->element == element) // Make sure right child isn't a duplicate of element.
-                    return;
-                else
-                    treeQueue.push(currentNode->right);
-            }
-            else
-            {
-                currentNode->right = new Node<T>(element);
-                break;
-            }
+            std::stable_sort(sortedOrder.begin() + start, sortedOrder.begin() + end, elementLess);
+        });
+        for(int width = 1; width < segmentCount; width *= 2)
+            for(int segment = 0; segment + width < segmentCount; segment += 2*width)
+                std::inplace_merge(sortedOrder.begin() + ExecutionPolicy::segmentStart(segment, nodeCount, segmentCount),
+                                   sortedOrder.begin() + ExecutionPolicy::segmentStart(segment + width, nodeCount, segmentCount),
+                                   sortedOrder.begin() + ExecutionPolicy::segmentStart(std::min(segment + 2*width, segmentCount), nodeCount, segmentCount),
+                                   elementLess);
+        
+        // Add the elements to the index in ascending order. The index holds each one until its position is known.
+        entries.assign(nodeCount, elementIndex.end());
+        typename std::map<const T*, int, ElementLess>::iterator hint = elementIndex.begin();
+        for(const int index : sortedOrder)
+        {
+            typename std::map<const T*, int, ElementLess>::iterator added = elementIndex.insert(hint, std::make_pair(&newNodes[index]->element, -1));
+            if(added->first == &newNodes[index]->element)
+                entries[index] = added;
+            hint = std::next(added);
         }
     }
+    catch(...)  // Take the new elements back out of the index and destroy their nodes.
+    {
+        for(typename std::map<const T*, int, ElementLess>::iterator entry : entries)
+            if(entry != elementIndex.end())
+                elementIndex.erase(entry);
+        for(TreeNode<T>* newNode : newNodes)
+            nodes.destroy(newNode);
+        throw;
+    }
     
-    treeSize++;
+    // Give every new element the next level order position, in range order.
+    for(int i = 0; i < (int)newNodes.size(); i++)
+    {
+        if(entries[i] == elementIndex.end())    // A duplicate.
+        {
+            nodes.destroy(newNodes[i]);
+            continue;
+        }
+        
+        entries[i]->second = (int)levelOrder.size();
+        linkNode(newNodes[i]);
+        treeSize++;
+    }
 }
 
 /**
@@ -313,18 +461,25 @@ void BinaryTree<T>::insert(const T element)
  * @details Returns true if the element is in the tree, otherwise returns false.
  */
 template <typename T>
-bool BinaryTree<T>::bfsearch(const T& element)
+bool BinaryTree<T>::bfsearch(const T& element) const
 {
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::SEARCH);
+#endif
     if(root == nullptr)
         return false;
     else
     {
-        std::queue<Node<T>*> treeQueue;
+        std::queue<TreeNode<T>*> treeQueue;
         treeQueue.push(root);
-        Node<T>* currentNode;
+        TreeNode<T>* currentNode;
         
         while(!treeQueue.empty())
         {
+#if defined(DATASTRUCTURES_STATS)
+            nodes.getStats().recordQueueSize(ContainerStats::SEARCH, (int)treeQueue.size());
+            nodes.getStats().recordTraversal(ContainerStats::SEARCH, 1);
+#endif
             currentNode = treeQueue.front();
             treeQueue.pop();
             
@@ -344,47 +499,59 @@ bool BinaryTree<T>::bfsearch(const T& element)
 }
 
 /**
- * @brief   Depth First Search.
+ * @brief   Breadth First Search on several threads.
  *
  * @tparam T        Any data type or class.
  * @param element   The element being searched for in the tree.
  * @return          A boolean flag.
  *
- * @details Returns true if the element is in the tree, otherwise returns false.
+ * @details Returns true if the element is in the tree, otherwise returns false. The level order
+ *          list is split into one contiguous part per hardware thread, and every thread stops
+ *          as soon as any of them finds the element. Small trees are searched on the calling thread.
  *
- * @note    This Depth First Search uses inorder traversal.
+ * @throw   Rethrows the first exception thrown by comparing elements, once every thread is done.
  */
 template <typename T>
-bool BinaryTree<T>::dfsearch(const T& element)
+bool BinaryTree<T>::parallelBfsearch(const T& element) const
 {
-    if(root == nullptr)
-        return false;
-    else
+    int threadCount = threadsFor(treeSize);
+    if(threadCount == 1)
+        return bfsearch(element);
+    
+    std::atomic<bool> found(false);
+    ExecutionPolicy::parallel(threadCount).runSegments(treeSize, threadCount, [this, &element, &found](const int, const int start, const int end)
     {
-        std::stack<Node<T>*> treeStack;
-        treeStack.push(root);
-        Node<T>* currentNode = root->left;
-        
-        while(!treeStack.empty() || currentNode != nullptr)
+        for(int position = start; position < end; position++)
         {
-            if(currentNode != nullptr)
+            if(levelOrder[position]->element == element)
             {
-                treeStack.push(currentNode);
-                currentNode = currentNode->left;
-                continue;
+                found.store(true, std::memory_order_relaxed);
+                return;
             }
-            
-            currentNode = treeStack.top();
-            treeStack.pop();
-            
-            if(currentNode->element == element)
-                return true;
-            
-            currentNode = currentNode->right;
+            if(position % 1024 == 0 && found.load(std::memory_order_relaxed))    // Another thread already found it.
+                return;
         }
-    }
+    });
     
-    return false;
+    return found.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Depth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the tree, otherwise returns false.
+ *
+ * @note    This Depth First Search uses inorder traversal.
+ */
+template <typename T>
+bool BinaryTree<T>::dfsearch(const T& element) const
+{
+    auto notFound = [&element](const TreeNode<T>* node) { return !(node->element == element); };
+    return !visitInorder(notFound);
 }
 
 /**
@@ -394,72 +561,87 @@ bool BinaryTree<T>::dfsearch(const T& element)
  * @param element   The element to be removed from the tree.
  */
 template <typename T>
-void BinaryTree<T>::remove(const T element)
+void BinaryTree<T>::remove(const T& element)
 {
-    if(root == nullptr)
-        return;
-    
-    std::queue<Node<T>*> treeQueue;
-    treeQueue.push(root);
-    Node<T>* currentNode;
-    Node<T>* deepestParent = nullptr;
-    Node<T>* deleteNode = nullptr;
-    
-    while(!treeQueue.empty())
-    {
-        currentNode = treeQueue.front();
-        treeQueue.pop();
-        
-        if(currentNode->element == element) // If we found the element we want to delete.
-            deleteNode = currentNode;
-        
-        // Deepest parent can only be found as long as currentNode has at least one child.
-        if(currentNode->left != nullptr || currentNode->right != nullptr)
-            deepestParent = currentNode;
-        
-        if(currentNode->left != nullptr)
-            treeQueue.push(currentNode->left);
-        if(currentNode->right != nullptr)
-            treeQueue.push(currentNode->right);
-    }
-    
-    if(deleteNode == nullptr)           // If element doesn't exist in the tree.
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::REMOVE);
+#endif
+    typename std::map<const T*, int, ElementLess>::iterator found = elementIndex.find(&element);
+    if(found == elementIndex.end())     // If element doesn't exist in the tree.
         return;
-    else if(deepestParent == nullptr)   // If root is only value in the tree.
+    else if(treeSize == 1)              // If root is only value in the tree.
     {
         clear();
         return;
     }
     
+    int deletePosition = found->second;
+    TreeNode<T>* deleteNode = levelOrder[deletePosition];
+    TreeNode<T>* deepestNode = levelOrder.back();
+    elementIndex.erase(found);
+    
     // Otherwise overwrite the deleteNode element with deepest element in tree.
-    if(deepestParent->right != nullptr) // If deepestParent has a right child.
+    if(deleteNode != deepestNode)
     {
-        deleteNode->element = deepestParent->right->element;
-        deleteNode = deepestParent->right;
-        deepestParent->right = nullptr;
+        elementIndex.erase(&deepestNode->element);
+        deleteNode->element = std::move(deepestNode->element);
+        elementIndex.insert(std::make_pair(&deleteNode->element, deletePosition));
     }
-    else    // Else if deepestParent only has a left child.
-    {
-        deleteNode->element = deepestParent->left->element;
-        deleteNode = deepestParent->left;
+    
+    // Detach the deepest node from its parent.
+    int deepestPosition = (int)levelOrder.size() - 1;
+    levelOrder.pop_back();
+    TreeNode<T>* deepestParent = levelOrder[(deepestPosition-1)/2];
+    if(deepestParent->right == deepestNode)
+        deepestParent->right = nullptr;
+    else
         deepestParent->left = nullptr;
-    }
     
-    delete deleteNode;
+    nodes.destroy(deepestNode);
     treeSize--;
 }
 
 /**
- * @brief   Clears the entire tree recursively and resets all field elements to default.
+ * @brief   Clears the entire tree and resets all field elements to default.
  *
  * @tparam T    Any data type or class.
+ *
+ * @details Tears the tree down without recursion and with constant extra space: a node with a
+ *          left child is rotated right until it has none, then it is destroyed and its right
+ *          child is handled next. If this tree is the only user of its node pool, the whole pool
+ *          is released at once, and the walk is skipped entirely when the elements are trivially
+ *          destructible. Otherwise every node is given back to the shared pool for reuse.
  */
 template <typename T>
 void BinaryTree<T>::clear()
 {
-    delete root;
+    nodes.destroyTree(root);
+    
     root = nullptr;
     treeSize = 0;
+    inverted = false;
+    levelOrder.clear();
+    elementIndex.clear();
+}
+
+/**
+ * @brief   Replaces the contents of the tree with the elements of a range.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ *
+ * @details Clears the tree and inserts the elements in level order. See insertBulk().
+ *
+ * @warning The range must not point into this tree.
+ */
+template <typename T>
+template <typename Iterator>
+void BinaryTree<T>::assign(Iterator first, Iterator last)
+{
+    clear();
+    insertBulk(first, last);
 }
 
 /**
@@ -469,7 +651,7 @@ void BinaryTree<T>::clear()
  * @return      The size of the tree.
  */
 template <typename T>
-int BinaryTree<T>::size()
+int BinaryTree<T>::size() const
 {
     return treeSize;
 }
@@ -481,257 +663,948 @@ int BinaryTree<T>::size()
  * @return      A boolean flag.
  */
 template <typename T>
-bool BinaryTree<T>::empty()
+bool BinaryTree<T>::empty() const
 {
     return treeSize == 0;
 }
 
 /**
- * @brief   Returns depth of the specified element in tree.
+ * @brief   Returns the node pool used by this tree.
  *
- * @tparam T        Any data type or class.
- * @param element   The element whose depth we are calculating.
- * @return          Depth of element.
- */
-template <typename T>
-int BinaryTree<T>::depth(const T& element)
-{
-    if(root == nullptr) // Tree is empty.
-        return -1;
-    
-    if(root->element == element)
-        return 0;
-    
-    int leftDepth = getDepth(root->left, element, 1);
-    int rightDepth = getDepth(root->right, element, 1);
-    
-    return (leftDepth < rightDepth) ? rightDepth : leftDepth;
-}
-
-/**
- * @brief   Returns height of the specified element in tree.
+ * @tparam T    Any data type or class.
+ * @return      The shared node pool.
  *
- * @tparam T        Any data type or class.
- * @param element   The element whose height we are calculating.
- * @return          Height of element.
+ * @details The returned pool can be passed to the Shared Pool Constructor of another tree
+ *          so both trees allocate from, and recycle into, the same pool.
  */
 template <typename T>
-int BinaryTree<T>::height(const T& element)
+std::shared_ptr<NodePool<TreeNode<T>>> BinaryTree<T>::getPool()
 {
-    if(root == nullptr) // Tree is empty.
-        return -1;
-    
-    return getHeight(root, element, 0, false);
+    return nodes.getPool();
 }
 
+#if defined(DATASTRUCTURES_STATS)
 /**
- * @brief   Recursively inverts the tree.
+ * @brief   Returns the statistics of this tree.
  *
  * @tparam T    Any data type or class.
+ * @return      The statistics, with the bytes held brought up to date.
+ *
+ * @details Counts the nodes allocated and freed, and the bytes held by the nodes, the level order
+ *          list and the element index. The element index is estimated as one map node of four
+ *          pointers and a pair per element.
+ *
+ *          For insert(), remove() and bfsearch() it also counts the calls and the latencies.
+ *          Only bfsearch() visits nodes and keeps a breadth first queue, insert() and remove()
+ *          look their positions up in the level order list and the element index, so their
+ *          traversals and queue high-water marks stay at 0.
+ *
+ * @note    Only available when DATASTRUCTURES_STATS is defined.
  */
 template <typename T>
-void BinaryTree<T>::invertTree()
+const ContainerStats& BinaryTree<T>::stats()
 {
-    invert(root);
+    ContainerStats& treeStats = nodes.getStats();
+    treeStats.recordBytesHeld((long long)treeSize * sizeof(TreeNode<T>)
+                        + (long long)levelOrder.capacity() * sizeof(TreeNode<T>*)
+                        + (long long)elementIndex.size() * (4*sizeof(void*) + sizeof(std::pair<const T* const, int>)));
+    return treeStats;
 }
+#endif
 
 /**
- * @brief   Prints tree Inorder.
+ * @brief   Writes the tree to a stream in the compact binary format.
  *
- * @tparam T    Any data type or class.
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader, flagged when the tree is inverted, and then every element in level
+ *          order, as if the tree was never inverted, with ElementCodec<T>. Read it back with deserialize().
  */
 template <typename T>
-void BinaryTree<T>::printInorder()
+void BinaryTree<T>::serialize(std::ostream& output) const
 {
-    if(root == nullptr)
-    {
-        std::cout << "()" << std::endl;
-        return;
-    }
-    
-    std::cout << "[root: " << root->element << "]\t" << "(";
-    print(root, 'i');
-    std::cout << ")" << std::endl;
+    writeSerialHeader(output, SERIAL_MAGIC, SERIAL_BINARY_TREE, inverted ? SERIAL_INVERTED : 0, ElementCodec<T>::SIZE, (std::uint64_t)treeSize);
+    for(const TreeNode<T>* node : levelOrder)
+        ElementCodec<T>::write(output, node->element);
 }
 
 /**
- * @brief   Prints tree Preorder.
+ * @brief   Replaces the contents of the tree with a tree read from the compact binary format.
  *
- * @tparam T    Any data type or class.
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param input     The input stream, opened in binary mode, at data written by serialize().
+ *
+ * @details The elements are read first and then inserted with insertBulk() into a new tree, that
+ *          allocates from the node pool of this tree, is inverted again if the tree was inverted, and
+ *          then takes the place of this tree. Every element ends up at the same position as before.
+ *          At most SERIAL_READ_CHUNK elements are reserved before they are read, so a corrupt count fails
+ *          with the truncated data error instead of a huge allocation. If anything goes wrong, this tree is unchanged.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serialize() of a Binary Tree
+ *          with the same element type, or if the input ends early.
  */
 template <typename T>
-void BinaryTree<T>::printPreorder()
+void BinaryTree<T>::deserialize(std::istream& input)
 {
-    if(root == nullptr)
-    {
-        std::cout << "()" << std::endl;
-        return;
-    }
+    SerialHeader header = readSerialHeader(input, SERIAL_BINARY_TREE, ElementCodec<T>::SIZE);
+    std::vector<T> elements;
+    elements.reserve((std::size_t)std::min<std::uint64_t>(header.count, SERIAL_READ_CHUNK));
+    for(std::uint64_t i = 0; i < header.count; i++)
+        elements.push_back(ElementCodec<T>::read(input));
     
-    std::cout << "[root: " << root->element << "]\t" << "(";
-    print(root, 'r');
-    std::cout << ")" << std::endl;
+    BinaryTree<T> temp(nodes.getPool());
+    temp.insertBulk(std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+    if(header.flags & SERIAL_INVERTED)
+        temp.invertTree();
+    
+    swap(temp);
 }
 
 /**
- * @brief   Prints tree Postorder.
+ * @brief   Writes the tree to a stream in the flat binary format.
  *
- * @tparam T    Any data type or class.
+ * @tparam T        A trivially copyable type.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader, flagged when the tree is inverted, and then the raw elements in level
+ *          order, as if the tree was never inverted, aligned for T. The written file can be memory mapped
+ *          and used in place through a FlatView, which finds the children of every element by its
+ *          position, or loaded again with deserializeFlat().
  */
 template <typename T>
-void BinaryTree<T>::printPostorder()
+void BinaryTree<T>::serializeFlat(std::ostream& output) const
 {
-    if(root == nullptr)
-    {
-        std::cout << "()" << std::endl;
-        return;
-    }
+    static_assert(std::is_trivially_copyable<T>::value, "The flat format needs a trivially copyable element type");
     
-    std::cout << "[root: " << root->element << "]\t" << "(";
-    print(root, 'o');
-    std::cout << ")" << std::endl;
+    writeSerialHeader(output, FLAT_MAGIC, SERIAL_BINARY_TREE, inverted ? SERIAL_INVERTED : 0, sizeof(T), (std::uint64_t)treeSize, alignof(T));
+    for(const TreeNode<T>* node : levelOrder)
+        output.write(reinterpret_cast<const char*>(&node->element), sizeof(T));
 }
 
 /**
- * @brief   Calculates the depth of an element in tree.
+ * @brief   Replaces the contents of the tree with the elements of data in the flat binary format.
  *
- * @tparam T        Any data type or class.
- * @param current   The current Node we are looking at in tree.
- * @param element   The element whose depth we are calculating.
- * @param depth     The depth of the current node.
- * @return          Depth of element.
+ * @tparam T        A trivially copyable type.
+ * @param data      The start of data written by serializeFlat(), for example a memory mapped file.
+ * @param bytes     The size of the data.
+ *
+ * @details Nothing is parsed, the level order array is bulk loaded straight out of the data with
+ *          assign(), see insertBulk(), and inverted again if the tree was inverted.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serializeFlat() of a Binary Tree
+ *          with the same element type, or if it is truncated or misaligned. This tree is unchanged then.
  */
 template <typename T>
-int BinaryTree<T>::getDepth(const Node<T>* current, const T& element, int depth)
+void BinaryTree<T>::deserializeFlat(const void* data, const std::size_t bytes)
 {
-    if(current == nullptr)  // Element was not found.
-        return -1;
-    else if(current->element == element)
-        return depth;
-    
-    int leftDepth = getDepth(current->left, element, depth+1);
-    int rightDepth = getDepth(current->right, element, depth+1);
-    
-    return (leftDepth < rightDepth) ? rightDepth : leftDepth;
+    FlatView<T> view(data, bytes, SERIAL_BINARY_TREE);
+    assign(view.begin(), view.end());
+    if(view.inverted())
+        invertTree();
 }
 
 /**
- * @brief   Calculates the height of an element in tree.
+ * @brief   Writes every element of the tree to a sink, in the specified order.
  *
  * @tparam T            Any data type or class.
- * @param current       The current Node we are looking at in tree.
- * @param element       The element whose height we are calculating.
- * @param height        The height of the current node.
- * @param elementFound  True if the element was found in the tree, otherwise false.
- * @return              Height of element.
+ * @tparam Sink         Any type with a write(const char* data, std::size_t size) function, like std::ostream,
+ *                      StringSink, BufferSink or FileDescriptorSink.
+ * @param sink          The sink the elements are written to.
+ * @param separator     The text written between two elements.
+ * @param printOrder    The order in which to write the tree, 'i' for inorder, 'r' for preorder and 'o' for postorder.
+ *
+ * @details The traversals do not recurse, and the elements are formatted through a BufferedWriter, so a
+ *          tree of any size is written with a single chunk of memory. When the sink is a stream, the
+ *          elements are formatted with the formatting of the stream.
  */
 template <typename T>
-int BinaryTree<T>::getHeight(const Node<T>* current, const T& element, int height, bool elementFound)
+template <typename Sink>
+void BinaryTree<T>::writeTo(Sink& sink, const char* separator, const char printOrder) const
 {
-    if(current == nullptr && !elementFound) // Element was not found in tree/subtree.
-        return -1;
-    else if(current == nullptr && elementFound)
-        return height;
+    BufferedWriter<Sink> writer(sink, formatOf(sink));
+    bool first = true;
+    auto writeElement = [&writer, &first, separator](const T& element)
+    {
+        if(!first)
+            writer.write(separator);
+        writer.writeElement(element);
+        first = false;
+    };
     
-    if(elementFound)
-        height++;
-    else if(current->element == element)
-        elementFound = true;
+    switch (printOrder)
+    {
+        case 'i':   // Inorder
+            forEachInorder(writeElement);
+            break;
+        case 'r':   // Preorder
+            forEachPreorder(writeElement);
+            break;
+        case 'o':   // Postorder
+            forEachPostorder(writeElement);
+            break;
+    }
     
-    int leftHeight = getHeight(current->left, element, height, elementFound);
-    int rightHeight = getHeight(current->right, element, height, elementFound);
+    writer.flush();
+}
+
+/**
+ * @brief   Returns depth of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose depth we are calculating.
+ * @return          Depth of element, or -1 if the element is not in the tree.
+ *
+ * @details The level order position of the element is looked up in the element index,
+ *          and the depth follows from the position alone, so no part of the tree is walked.
+ */
+template <typename T>
+int BinaryTree<T>::depth(const T& element) const
+{
+    int position = positionOf(element);
+    return (position == -1) ? -1 : depthAt(position);
+}
+
+/**
+ * @brief   Returns height of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose height we are calculating.
+ * @return          Height of element, or -1 if the element is not in the tree.
+ *
+ * @details The level order position of the element is looked up in the element index,
+ *          and the height follows from the position and the size of the tree,
+ *          so no part of the tree is walked.
+ */
+template <typename T>
+int BinaryTree<T>::height(const T& element) const
+{
+    int position = positionOf(element);
+    return (position == -1) ? -1 : heightAt(position);
+}
+
+/**
+ * @brief   Returns the depths of several elements at once.
+ *
+ * @tparam T        Any data type or class.
+ * @param elements  The elements whose depths we are calculating.
+ * @return          The depth of every element, in the same order as the elements,
+ *                  with -1 for every element that is not in the tree.
+ *
+ * @details Every element costs one lookup in the element index, O(log n).
+ */
+template <typename T>
+std::vector<int> BinaryTree<T>::depths(const std::vector<T>& elements) const
+{
+    std::vector<int> elementDepths;
+    elementDepths.reserve(elements.size());
+    for(const T& element : elements)
+        elementDepths.push_back(depth(element));
     
-    return (leftHeight < rightHeight) ? rightHeight : leftHeight;
+    return elementDepths;
 }
 
 /**
- * @brief   Inverts all the left and right children of a node in the tree.
+ * @brief   Returns the heights of several elements at once.
  *
- * @tparam T            Any data type or class.
- * @param invertNode    The node whose children will be inverted.
+ * @tparam T        Any data type or class.
+ * @param elements  The elements whose heights we are calculating.
+ * @return          The height of every element, in the same order as the elements,
+ *                  with -1 for every element that is not in the tree.
+ *
+ * @details Every element costs one lookup in the element index, O(log n).
+ */
+template <typename T>
+std::vector<int> BinaryTree<T>::heights(const std::vector<T>& elements) const
+{
+    std::vector<int> elementHeights;
+    elementHeights.reserve(elements.size());
+    for(const T& element : elements)
+        elementHeights.push_back(height(element));
+    
+    return elementHeights;
+}
+
+/**
+ * @brief   Inverts the tree.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Swaps the children of every node in the level order list, so no recursion is needed.
+ *          Inverting an empty tree does nothing.
  */
 template <typename T>
-void BinaryTree<T>::invert(Node<T>* invertNode)
+void BinaryTree<T>::invertTree()
 {
-    if(invertNode == nullptr)
+    if(treeSize == 0)   // An empty tree stays uninverted, like after clear().
         return;
     
-    Node<T>* temp = invertNode->left;
-    invertNode->left = invertNode->right;
-    invertNode->right = temp;
+    for(TreeNode<T>* node : levelOrder)
+    {
+        TreeNode<T>* temp = node->left;
+        node->left = node->right;
+        node->right = temp;
+    }
     
-    invert(invertNode->left);
-    invert(invertNode->right);
+    inverted = !inverted;
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal does not recurse and does not allocate, it keeps its path on a
+ *          fixed size stack of MAX_LEVELS nodes, which the tree is never deeper than.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T>
+template <typename Function>
+void BinaryTree<T>::forEachInorder(Function visit) const
+{
+    auto visitElement = [&visit](const TreeNode<T>* node) { visit(node->element); return true; };
+    visitInorder(visitElement);
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal does not recurse and does not allocate, it keeps its path on a
+ *          fixed size stack of MAX_LEVELS nodes, which the tree is never deeper than.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T>
+template <typename Function>
+void BinaryTree<T>::forEachPreorder(Function visit) const
+{
+    auto visitElement = [&visit](const TreeNode<T>* node) { visit(node->element); return true; };
+    visitPreorder(visitElement);
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal does not recurse and does not allocate, it keeps its path on a
+ *          fixed size stack of MAX_LEVELS nodes, which the tree is never deeper than.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T>
+template <typename Function>
+void BinaryTree<T>::forEachPostorder(Function visit) const
+{
+    auto visitElement = [&visit](const TreeNode<T>* node) { visit(node->element); return true; };
+    visitPostorder(visitElement);
 }
 
 /**
- * @brief   Prints the binary tree.
+ * @brief   Calls a function with every element of the tree, in level order.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details Walks the level order list, so no recursion and no queue is needed. A parallel policy
+ *          splits the level order list into one contiguous part per thread, each visited with its
+ *          own copy of the function.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T>
+template <typename Function>
+void BinaryTree<T>::forEach(Function visit, const ExecutionPolicy& policy) const
+{
+    policy.runSegments(treeSize, policy.segmentsFor(treeSize), [this, &visit](const int, const int start, const int end)
+    {
+        Function segmentVisit(visit);
+        for(int position = start; position < end; position++)
+            segmentVisit(levelOrder[position]->element);
+    });
+}
+
+/**
+ * @brief   Combines every element of the tree into one result.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Result   The type of the result.
+ * @tparam Combine  A callable that combines any mix of a Result and an element into a Result.
+ * @param init      The value the result starts from.
+ * @param combine   The combination.
+ * @param policy    The execution policy, sequential by default.
+ * @return          The combination of init and every element.
+ *
+ * @details Combines the elements in level order. A parallel policy combines one contiguous part of
+ *          the level order list per thread and then the part results, so the combination must be
+ *          associative and commutative, like for std::reduce().
+ */
+template <typename T>
+template <typename Result, typename Combine>
+Result BinaryTree<T>::reduce(Result init, Combine combine, const ExecutionPolicy& policy) const
+{
+    int segmentCount = policy.segmentsFor(treeSize);
+    if(segmentCount == 1)
+    {
+        for(const TreeNode<T>* node : levelOrder)
+            init = combine(std::move(init), node->element);
+        return init;
+    }
+    
+    std::vector<Result> partials(segmentCount, init);
+    policy.runSegments(treeSize, segmentCount, [this, &combine, &partials](const int segment, const int start, const int end)
+    {
+        Combine segmentCombine(combine);
+        Result partial = segmentCombine(levelOrder[start]->element, levelOrder[start+1]->element);
+        for(int position = start+2; position < end; position++)
+            partial = segmentCombine(std::move(partial), levelOrder[position]->element);
+        partials[segment] = std::move(partial);
+    });
+    
+    for(Result& partial : partials)
+        init = combine(std::move(init), std::move(partial));
+    return init;
+}
+
+/**
+ * @brief   Combines every element of the tree into a result of another type.
  *
  * @tparam T            Any data type or class.
- * @param node          The root element in the tree.
- * @param printOrder    The order in which to print the tree (In-, Pre-, Post- order).
+ * @tparam Result       The type of the result.
+ * @tparam Accumulate   A callable that adds an element to a Result and returns the new Result.
+ * @tparam Combine      A callable that combines two Results into one.
+ * @param identity      The value the result starts from, which combine() must leave unchanged, like 0 for a sum.
+ * @param accumulate    The accumulation.
+ * @param combine       The combination of two results.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The accumulation of every element onto identity.
+ *
+ * @details Accumulates the elements in level order. A parallel policy accumulates one contiguous part
+ *          of the level order list per thread, each starting from identity, and combines the part
+ *          results in order, so the combination must be associative.
  */
 template <typename T>
-void BinaryTree<T>::print(const Node<T>* node, const char& printOrder)
+template <typename Result, typename Accumulate, typename Combine>
+Result BinaryTree<T>::reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy) const
 {
-    if(node == nullptr)
-        return;
+    int segmentCount = policy.segmentsFor(treeSize);
+    std::vector<Result> partials(segmentCount, identity);
+    policy.runSegments(treeSize, segmentCount, [this, &accumulate, &partials](const int segment, const int start, const int end)
+    {
+        Accumulate segmentAccumulate(accumulate);
+        for(int position = start; position < end; position++)
+            partials[segment] = segmentAccumulate(std::move(partials[segment]), levelOrder[position]->element);
+    });
     
-    switch (printOrder)
+    Result result = std::move(partials[0]);
+    for(int segment = 1; segment < segmentCount; segment++)
+        result = combine(std::move(result), std::move(partials[segment]));
+    return result;
+}
+
+/**
+ * @brief   Returns the element of the tree closest to the root that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it matches.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              A pointer to the matching element, or nullptr if none matches.
+ *
+ * @details Tests the elements in level order, so of several matches on one level the one that was
+ *          inserted first is returned. A parallel policy searches one contiguous part of the level
+ *          order list per thread, and every thread stops at its first match or as soon as an earlier
+ *          part found one. Both return the same element.
+ *
+ * @warning The pointer is only valid until the tree is changed.
+ */
+template <typename T>
+template <typename Predicate>
+const T* BinaryTree<T>::findIf(Predicate predicate, const ExecutionPolicy& policy) const
+{
+    int segmentCount = policy.segmentsFor(treeSize);
+    std::vector<int> matches(segmentCount, -1);
+    std::atomic<int> firstMatch(segmentCount);  // The lowest part with a match so far.
+    policy.runSegments(treeSize, segmentCount, [this, &predicate, &matches, &firstMatch](const int segment, const int start, const int end)
     {
-        case 'i':   // Inorder
-            print(node->left, printOrder);
-            if (node->left && node->right)
-                std::cout << ", " << node->element << ", ";
-            else if(node->left)
-                std::cout << ", " << node->element;
-            else if(node->right)
-                std::cout << node->element << ", ";
-            else
-                std::cout << node->element;
-            print(node->right, printOrder);
-            break;
-        case 'r':   // Preorder
-            std::cout << node->element;
-            if (node->left && node->right)
-            {
-                std::cout << ", ";
-                print(node->left, printOrder);
-                std::cout << ", ";
-                print(node->right, printOrder);
-            }
-            else if(node->left)
-            {
-                std::cout << ", ";
-                print(node->left, printOrder);
-            }
-            else if(node->right)
-            {
-                std::cout  << ", ";
-                print(node->right, printOrder);
-            }
-            break;
-        case 'o':   // Postorder
-            if (node->left && node->right)
-            {
-                print(node->left, printOrder);
-                std::cout << ", ";
-                print(node->right, printOrder);
-                std::cout << ", ";
-            }
-            else if(node->left)
-            {
-                print(node->left, printOrder);
-                std::cout << ", ";
-            }
-            else if(node->right)
+        Predicate segmentPredicate(predicate);
+        for(int position = start; position < end; position++)
+        {
+            if(segmentPredicate(levelOrder[position]->element))
             {
-                std::cout  << ", ";
-                print(node->right, printOrder);
+                matches[segment] = position;
+                int lowest = firstMatch.load(std::memory_order_relaxed);
+                while(segment < lowest && !firstMatch.compare_exchange_weak(lowest, segment, std::memory_order_relaxed)) {}
+                return;
             }
-            std::cout << node->element;
-            break;
+            if(position % 1024 == 0 && firstMatch.load(std::memory_order_relaxed) < segment)   // An earlier part already found one.
+                return;
+        }
+    });
+    
+    for(const int position : matches)
+        if(position != -1)
+            return &levelOrder[position]->element;
+    return nullptr;
+}
+
+/**
+ * @brief   Removes every element of the tree that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it should be removed.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The number of removed elements.
+ *
+ * @details Tests every element first, on one contiguous part of the level order list per thread
+ *          for a parallel policy. Then the remaining elements keep their level order and are
+ *          relinked into a complete tree in a single pass, instead of filling every gap with the
+ *          deepest element like remove() does. The nodes are destroyed on the calling thread,
+ *          because the node pool is not thread safe.
+ *
+ * @note    If the predicate throws, the tree is unchanged.
+ */
+template <typename T>
+template <typename Predicate>
+int BinaryTree<T>::removeIf(Predicate predicate, const ExecutionPolicy& policy)
+{
+    std::vector<char> matches(treeSize, 0);
+    policy.runSegments(treeSize, policy.segmentsFor(treeSize), [this, &predicate, &matches](const int, const int start, const int end)
+    {
+        Predicate segmentPredicate(predicate);
+        for(int position = start; position < end; position++)
+            matches[position] = segmentPredicate(levelOrder[position]->element) ? 1 : 0;
+    });
+    
+    // Give every remaining element its new level order position.
+    std::vector<int> newPosition(treeSize, -1);
+    int remaining = 0;
+    for(int position = 0; position < treeSize; position++)
+        if(!matches[position])
+            newPosition[position] = remaining++;
+    
+    int removed = treeSize - remaining;
+    if(removed == 0)
+        return 0;
+    else if(remaining == 0)
+    {
+        clear();
+        return removed;
+    }
+    
+    for(typename std::map<const T*, int, ElementLess>::iterator entry = elementIndex.begin(); entry != elementIndex.end();)
+    {
+        if(matches[entry->second])
+            entry = elementIndex.erase(entry);
+        else
+        {
+            entry->second = newPosition[entry->second];
+            ++entry;
+        }
     }
+    
+    std::vector<TreeNode<T>*> oldOrder;
+    oldOrder.swap(levelOrder);
+    levelOrder.reserve(remaining);
+    for(int position = 0; position < treeSize; position++)
+    {
+        TreeNode<T>* node = oldOrder[position];
+        if(matches[position])
+        {
+            nodes.destroy(node);
+            continue;
+        }
+        
+        node->left = nullptr;
+        node->right = nullptr;
+        linkNode(node);
+    }
+    
+    treeSize = remaining;
+    return removed;
+}
+
+/**
+ * @brief   Prints tree Inorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void BinaryTree<T>::printInorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    writeTo(std::cout, ", ", 'i');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Preorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void BinaryTree<T>::printPreorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    writeTo(std::cout, ", ", 'r');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Postorder.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+void BinaryTree<T>::printPostorder()
+{
+    if(root == nullptr)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << root->element << "]\t" << "(";
+    writeTo(std::cout, ", ", 'o');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Attaches a node to the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @param newNode   The node to attach to the tree.
+ * @return          True if the node was attached, false if its element is a duplicate.
+ *
+ * @details The tree is always complete, so the parent of the first open position is found in
+ *          levelOrder at index (position-1)/2. The element index catches every duplicate.
+ */
+template <typename T>
+bool BinaryTree<T>::attachNode(TreeNode<T>* newNode)
+{
+    if(!elementIndex.insert(std::make_pair(&newNode->element, (int)levelOrder.size())).second)    // Element is a duplicate.
+        return false;
+    
+    linkNode(newNode);
+    return true;
+}
+
+/**
+ * @brief   Links a node into the first open level order position.
+ *
+ * @tparam T        Any data type or class.
+ * @param newNode   The node to link. Its element must already be in the element index.
+ */
+template <typename T>
+void BinaryTree<T>::linkNode(TreeNode<T>* newNode)
+{
+    levelOrder.push_back(newNode);
+    int position = (int)levelOrder.size() - 1;
+    if(position == 0)
+        root = newNode;
+    else
+    {
+        TreeNode<T>* parent = levelOrder[(position-1)/2];
+        bool leftChild = (position % 2 == 1);
+        if(leftChild != inverted)   // An inverted tree fills every level from right to left.
+            parent->left = newNode;
+        else
+            parent->right = newNode;
+    }
+}
+
+/**
+ * @brief   Returns the number of threads to split work on a number of elements across.
+ *
+ * @tparam T            Any data type or class.
+ * @param elementCount  The number of elements.
+ * @return              One thread per hardware thread for large amounts of work, otherwise 1.
+ */
+template <typename T>
+int BinaryTree<T>::threadsFor(const int elementCount)
+{
+    if(elementCount < PARALLEL_THRESHOLD)
+        return 1;
+    
+    int hardwareThreads = (int)std::thread::hardware_concurrency();
+    return (hardwareThreads > 1) ? hardwareThreads : 1;
+}
+
+/**
+ * @brief   Returns the level order position of an element.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          The position of the element, or -1 if the element is not in the tree.
+ */
+template <typename T>
+int BinaryTree<T>::positionOf(const T& element) const
+{
+    typename std::map<const T*, int, ElementLess>::const_iterator found = elementIndex.find(&element);
+    return (found == elementIndex.end()) ? -1 : found->second;
+}
+
+/**
+ * @brief   Returns the depth of a level order position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  The level order position.
+ * @return          The depth of the position.
+ *
+ * @details Every level holds twice as many positions as the one above it,
+ *          so the depth is the number of times the parent (position-1)/2 can be taken.
+ */
+template <typename T>
+int BinaryTree<T>::depthAt(const int position) const
+{
+    int positionDepth = 0;
+    for(int current = position; current > 0; current = (current-1)/2)
+        positionDepth++;
+    
+    return positionDepth;
+}
+
+/**
+ * @brief   Returns the height of a level order position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  The level order position.
+ * @return          The height of the position.
+ *
+ * @details The tree is complete, so the longest path below any node is the one that keeps
+ *          taking the first filled child, position 2*position+1, which inverting the tree does not change.
+ */
+template <typename T>
+int BinaryTree<T>::heightAt(const int position) const
+{
+    int positionHeight = 0;
+    long long child = 2LL*position + 1;
+    while(child < (long long)levelOrder.size())
+    {
+        positionHeight++;
+        child = 2*child + 1;
+    }
+    
+    return positionHeight;
+}
+
+/**
+ * @brief   Walks the tree in inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Visitor  A callable that takes a node and returns false to stop the walk.
+ * @param visit     The function called with every node.
+ * @return          False if the walk was stopped by the visitor, otherwise true.
+ *
+ * @details Keeps the nodes whose left subtree is being walked on a fixed size stack.
+ */
+template <typename T>
+template <typename Visitor>
+bool BinaryTree<T>::visitInorder(Visitor& visit) const
+{
+    const TreeNode<T>* path[MAX_LEVELS];
+    int pathSize = 0;
+    const TreeNode<T>* node = root;
+    
+    while(node != nullptr || pathSize > 0)
+    {
+        if(node != nullptr)
+        {
+            path[pathSize++] = node;
+            node = node->left;
+            continue;
+        }
+        
+        node = path[--pathSize];
+        if(!visit(node))
+            return false;
+        
+        node = node->right;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Walks the tree in preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Visitor  A callable that takes a node and returns false to stop the walk.
+ * @param visit     The function called with every node.
+ * @return          False if the walk was stopped by the visitor, otherwise true.
+ *
+ * @details Keeps the right children that still have to be walked on a fixed size stack,
+ *          so the stack never holds more than one node per level.
+ */
+template <typename T>
+template <typename Visitor>
+bool BinaryTree<T>::visitPreorder(Visitor& visit) const
+{
+    const TreeNode<T>* path[MAX_LEVELS];
+    int pathSize = 0;
+    const TreeNode<T>* node = root;
+    
+    while(node != nullptr)
+    {
+        if(!visit(node))
+            return false;
+        
+        if(node->left != nullptr)
+        {
+            if(node->right != nullptr)  // Walk the right child once the left subtree is done.
+                path[pathSize++] = node->right;
+            node = node->left;
+        }
+        else if(node->right != nullptr)
+            node = node->right;
+        else if(pathSize > 0)
+            node = path[--pathSize];
+        else
+            node = nullptr;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Walks the tree in postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Visitor  A callable that takes a node and returns false to stop the walk.
+ * @param visit     The function called with every node.
+ * @return          False if the walk was stopped by the visitor, otherwise true.
+ *
+ * @details Keeps the path from the root to the current node on a fixed size stack. A node is
+ *          visited once its right subtree is done, which is when the walk comes back up from it.
+ */
+template <typename T>
+template <typename Visitor>
+bool BinaryTree<T>::visitPostorder(Visitor& visit) const
+{
+    const TreeNode<T>* path[MAX_LEVELS];
+    int pathSize = 0;
+    const TreeNode<T>* node = root;
+    const TreeNode<T>* lastVisited = nullptr;
+    
+    while(node != nullptr || pathSize > 0)
+    {
+        if(node != nullptr)
+        {
+            path[pathSize++] = node;
+            node = node->left;
+            continue;
+        }
+        
+        const TreeNode<T>* top = path[pathSize-1];
+        if(top->right != nullptr && top->right != lastVisited)
+            node = top->right;
+        else
+        {
+            if(!visit(top))
+                return false;
+            
+            lastVisited = top;
+            pathSize--;
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Copies the elements of another tree into this tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param copyTree  The tree whose elements will be copied into this tree object.
+ *
+ * @details The shape of a tree only depends on its size and whether it is inverted, so the
+ *          level order array is copied position by position, reusing the nodes this tree already
+ *          has. Extra nodes are destroyed, and the missing nodes are reserved from the node pool
+ *          with a single allocation. The element index of the other tree is already in element
+ *          order, so every entry is added right after the one before, without any comparisons.
+ */
+template <typename T>
+void BinaryTree<T>::copyFrom(const BinaryTree<T>& copyTree)
+{
+    int copyCount = (int)copyTree.levelOrder.size();
+    int reused = std::min((int)levelOrder.size(), copyCount);
+    
+    // The extra nodes are the last leaves in level order, detach them from the bottom up.
+    for(int position = (int)levelOrder.size() - 1; position >= reused; position--)
+    {
+        TreeNode<T>* extraNode = levelOrder[position];
+        if(position > 0)
+        {
+            TreeNode<T>* parent = levelOrder[(position-1)/2];
+            if(parent->right == extraNode)
+                parent->right = nullptr;
+            else
+                parent->left = nullptr;
+        }
+        nodes.destroy(extraNode);
+    }
+    levelOrder.resize(reused);
+    treeSize = reused;
+    if(reused == 0)
+        root = nullptr;
+    
+    // Mirror the reused nodes if only one of the trees is inverted.
+    if(inverted != copyTree.inverted)
+        for(TreeNode<T>* node : levelOrder)
+            std::swap(node->left, node->right);
+    inverted = copyTree.inverted;
+    
+    elementIndex.clear();
+    try
+    {
+        for(int position = 0; position < reused; position++)
+            levelOrder[position]->element = copyTree.levelOrder[position]->element;
+        
+        if(copyCount > reused)
+        {
+            nodes.reserve(copyCount - reused);
+            levelOrder.reserve(copyCount);
+        }
+        for(int position = reused; position < copyCount; position++)
+        {
+            linkNode(nodes.create(copyTree.levelOrder[position]->element));
+            treeSize++;
+        }
+    }
+    catch(...)  // Without its element index the tree cannot be kept.
+    {
+        clear();
+        throw;
+    }
+    
+    for(typename std::map<const T*, int, ElementLess>::const_iterator entry = copyTree.elementIndex.begin(); entry != copyTree.elementIndex.end(); ++entry)
+        elementIndex.insert(elementIndex.end(), std::make_pair(&levelOrder[entry->second]->element, entry->second));
 }
 
 /**
@@ -743,13 +1616,21 @@ void BinaryTree<T>::print(const Node<T>* node, const char& printOrder)
 template <typename T>
 void BinaryTree<T>::swap(BinaryTree<T>& other)
 {
-    Node<T>* tempRoot = root;
+    TreeNode<T>* tempRoot = root;
     root = other.root;
     other.root = tempRoot;
     
     int tempSize = treeSize;
     treeSize = other.treeSize;
     other.treeSize = tempSize;
+    
+    bool tempInverted = inverted;
+    inverted = other.inverted;
+    other.inverted = tempInverted;
+    
+    levelOrder.swap(other.levelOrder);
+    elementIndex.swap(other.elementIndex);
+    nodes.swap(other.nodes);
 }
 
 
@@ -763,13 +1644,16 @@ void BinaryTree<T>::swap(BinaryTree<T>& other)
  * @param copyTree  The tree object from which to copy elements.
  * @return          A reference to a copied tree object.
  *
- * @details Copies a tree with the help of the copy constructor and a custom swap function.
+ * @details Overwrites the elements of the nodes this tree already has and only creates,
+ *          or destroys, the nodes that make up the difference in size. If copying an element throws,
+ *          this tree is cleared.
  */
 template <typename T>
 BinaryTree<T>& BinaryTree<T>::operator=(const BinaryTree& copyTree)
 {
-    BinaryTree<T> tempTree(copyTree);
-    tempTree.swap(*this);
+    if(this != &copyTree)
+        copyFrom(copyTree);
+    
     return *this;
 }
 
@@ -786,7 +1670,7 @@ BinaryTree<T>& BinaryTree<T>::operator=(const BinaryTree& copyTree)
  * @note    std::move() needs to be used to call this operator.
  */
 template <typename T>
-BinaryTree<T>& BinaryTree<T>::operator=(BinaryTree&& moveTree)
+BinaryTree<T>& BinaryTree<T>::operator=(BinaryTree&& moveTree) noexcept
 {
     if(this == &moveTree)   // Make sure this and moveTree are not the same object.
         return *this;
@@ -818,8 +1702,14 @@ BinaryTree<T>& BinaryTree<T>::operator=(BinaryTree&& moveTree)
 template <typename T>
 std::ostream& operator<<(std::ostream& output, const BinaryTree<T>& tree)
 {
-    if (tree.root)
-        return output << "[root: " << tree.root->element << "]\t" << "(" << *tree.root << ")";
-    else
+    if(tree.root == nullptr)
         return output << "()";
+    
+    output << "[root: " << tree.root->element << "]\t" << "(";
+    tree.writeTo(output);
+    return output << ")";
 }
+
+} // namespace DataStructures
+
+#endif /* BinaryTree_hpp */
@@ -0,0 +1,442 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    BufferedWriter.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The chunk buffered text output that every data structure writes its elements through.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef BufferedWriter_hpp
+#define BufferedWriter_hpp
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace DataStructures
+{
+
+/**
+ * @struct  StringSink
+ * @brief   A sink that appends everything written to it to a string.
+ */
+struct StringSink
+{
+    std::string& text;  /**< The string that is appended to. */
+    
+    /** Constructor. */
+    explicit StringSink(std::string& text) : text(text) {}
+    
+    /** Appends the data to the string. */
+    void write(const char* data, const std::size_t size) { text.append(data, size); }
+};
+
+/**
+ * @struct  BufferSink
+ * @brief   A sink that fills a fixed size character buffer, and drops whatever does not fit.
+ */
+struct BufferSink
+{
+    char* buffer;           /**< The buffer that is filled. */
+    std::size_t capacity;   /**< The size of the buffer. */
+    std::size_t size;       /**< The number of characters in the buffer. */
+    bool overflowed;        /**< True if anything was dropped because the buffer was full. */
+    
+    /** Constructor. */
+    BufferSink(char* buffer, const std::size_t capacity) : buffer(buffer), capacity(capacity), size(0), overflowed(false) {}
+    
+    /** Copies as much of the data as fits into the buffer. */
+    void write(const char* data, const std::size_t count)
+    {
+        std::size_t copied = (count < capacity - size) ? count : capacity - size;
+        std::memcpy(buffer + size, data, copied);
+        size += copied;
+        overflowed = overflowed || (copied < count);
+    }
+};
+
+/**
+ * @struct  FileDescriptorSink
+ * @brief   A sink that writes straight to a file descriptor, for example a file, pipe or socket.
+ */
+struct FileDescriptorSink
+{
+    int descriptor; /**< The file descriptor that is written to. */
+    
+    /** Constructor. */
+    explicit FileDescriptorSink(const int descriptor) : descriptor(descriptor) {}
+    
+    /** Writes all of the data, throws std::runtime_error if the file descriptor fails. */
+    void write(const char* data, const std::size_t size)
+    {
+        std::size_t written = 0;
+        while(written < size)
+        {
+#if defined(_WIN32)
+            int result = ::_write(descriptor, data + written, (unsigned int)(size - written));
+#else
+            ssize_t result = ::write(descriptor, data + written, size - written);
+#endif
+            if(result < 0 && errno == EINTR)    // Interrupted before anything was written, try again.
+                continue;
+            else if(result <= 0)
+                throw std::runtime_error("Failed to write to the file descriptor");
+            
+            written += (std::size_t)result;
+        }
+    }
+};
+
+/**
+ * @class   BufferedWriter
+ * @brief   Formats elements into a fixed size chunk and hands every full chunk to a sink.
+ * @details A sink is any object with a write(const char* data, std::size_t size) function, like
+ *          std::ostream, StringSink, BufferSink or FileDescriptorSink. The writer never holds more
+ *          than one chunk of BUFFER_SIZE characters, however many elements are written.
+ *
+ *          Integers, floating point numbers, characters and strings are formatted directly into the
+ *          chunk, exactly like a std::ostream with the default formatting would. Every other type, and
+ *          every type when the writer copies the formatting of a stream that is not the default, is
+ *          formatted with its own operator<< through one reused std::ostringstream.
+ * @tparam Sink The type of the sink.
+ *
+ * @note    Call flush() after the last write, the destructor does not flush.
+ */
+template <typename Sink>
+class BufferedWriter
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    explicit BufferedWriter(Sink& sink, const std::ios* format = nullptr);
+    BufferedWriter(const BufferedWriter<Sink>& copyWriter) = delete;
+    
+    // ----------- FUNCTIONS ------------
+    void write(const char* data, const std::size_t size);
+    void write(const char* text);
+    template <typename T>
+    void writeElement(const T& element);
+    void flush();
+    
+    // ----------- OPERATORS ------------
+    BufferedWriter<Sink>& operator=(const BufferedWriter<Sink>& copyWriter) = delete;
+    
+private:
+    // ----------- CONSTANTS ------------
+    static const std::size_t BUFFER_SIZE = 4096;    /**< The size of a chunk. */
+    
+    // ------------- FIELDS -------------
+    Sink& sink;                     /**< The sink every full chunk is handed to. */
+    char buffer[BUFFER_SIZE];       /**< The chunk that is being filled. */
+    std::size_t used;               /**< The number of characters in the chunk. */
+    bool defaultFormat;             /**< True if elements can be formatted directly into the chunk. */
+    std::ostringstream formatter;   /**< Formats the elements that are not formatted directly. */
+    
+    // ----------- FUNCTIONS ------------
+    template <typename T>
+    void format(const T& element, std::true_type);
+    template <typename T>
+    void format(const T& element, std::false_type);
+    void formatInteger(unsigned long long value, const bool negative);
+    void formatDirectly(const char element);
+    void formatDirectly(const char* element);
+    void formatDirectly(const std::string& element);
+    void formatDirectly(const bool element);
+    void formatDirectly(const float element);
+    void formatDirectly(const double element);
+    void formatDirectly(const long double element);
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type formatDirectly(const T element);
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type formatDirectly(const T element);
+};
+
+/**
+ * @struct  DirectlyFormatted
+ * @brief   True for the element types that a BufferedWriter formats without a stream.
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+struct DirectlyFormatted : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_same<T, std::string>::value
+                                                        || std::is_same<T, const char*>::value || std::is_same<T, char*>::value> {};
+
+/**
+ * @brief   Returns the stream whose formatting a writer to a sink copies.
+ *
+ * @tparam Sink A stream.
+ * @param sink  The stream.
+ * @return      The stream itself.
+ */
+template <typename Sink>
+typename std::enable_if<std::is_base_of<std::ios, Sink>::value, const std::ios*>::type formatOf(Sink& sink)
+{
+    return &sink;
+}
+
+/**
+ * @brief   Returns the stream whose formatting a writer to a sink copies.
+ *
+ * @tparam Sink Any sink that is not a stream.
+ * @return      Always nullptr, the default formatting is used.
+ */
+template <typename Sink>
+typename std::enable_if<!std::is_base_of<std::ios, Sink>::value, const std::ios*>::type formatOf(Sink&)
+{
+    return nullptr;
+}
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Sink Constructor.
+ *
+ * @tparam Sink     The type of the sink.
+ * @param sink      The sink every full chunk is handed to.
+ * @param format    The stream whose flags, precision, fill and locale the elements are formatted with,
+ *                  or nullptr for the default formatting. See formatOf().
+ *
+ * @details Elements are still formatted directly into the chunk when the stream has the default formatting.
+ */
+template <typename Sink>
+BufferedWriter<Sink>::BufferedWriter(Sink& sink, const std::ios* format) : sink(sink), used(0), defaultFormat(true)
+{
+    if(format == nullptr)
+        return;
+    
+    std::ios defaults(nullptr);
+    defaultFormat = format->flags() == defaults.flags() && format->precision() == defaults.precision() && format->width() == 0
+                    && format->getloc() == std::locale::classic();
+    formatter.copyfmt(*format);
+    formatter.exceptions(std::ios::goodbit);
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Writes characters.
+ *
+ * @tparam Sink The type of the sink.
+ * @param data  The characters.
+ * @param size  The number of characters.
+ *
+ * @details Hands the chunk to the sink whenever it fills up. Data larger than a chunk goes straight to the sink.
+ */
+template <typename Sink>
+void BufferedWriter<Sink>::write(const char* data, const std::size_t size)
+{
+    if(used + size > BUFFER_SIZE)
+    {
+        flush();
+        if(size >= BUFFER_SIZE)
+        {
+            sink.write(data, size);
+            return;
+        }
+    }
+    
+    std::memcpy(buffer + used, data, size);
+    used += size;
+}
+
+/**
+ * @brief   Writes a null terminated string.
+ *
+ * @tparam Sink The type of the sink.
+ * @param text  The string.
+ */
+template <typename Sink>
+void BufferedWriter<Sink>::write(const char* text)
+{
+    write(text, std::strlen(text));
+}
+
+/**
+ * @brief   Writes an element, formatted like operator<< would.
+ *
+ * @tparam Sink The type of the sink.
+ * @tparam T    Any data type or class with an operator<<.
+ * @param element   The element.
+ */
+template <typename Sink>
+template <typename T>
+void BufferedWriter<Sink>::writeElement(const T& element)
+{
+    if(defaultFormat)
+        format(element, DirectlyFormatted<T>());
+    else
+        format(element, std::false_type());
+}
+
+/**
+ * @brief   Hands the characters in the chunk to the sink.
+ *
+ * @tparam Sink The type of the sink.
+ */
+template <typename Sink>
+void BufferedWriter<Sink>::flush()
+{
+    if(used > 0)
+        sink.write(buffer, used);
+    used = 0;
+}
+
+/**
+ * @brief   Formats an element directly into the chunk.
+ *
+ * @tparam Sink     The type of the sink.
+ * @tparam T        An arithmetic type or a string.
+ * @param element   The element.
+ */
+template <typename Sink>
+template <typename T>
+void BufferedWriter<Sink>::format(const T& element, std::true_type)
+{
+    formatDirectly(element);
+}
+
+/**
+ * @brief   Formats an element with its operator<<.
+ *
+ * @tparam Sink     The type of the sink.
+ * @tparam T        Any data type or class with an operator<<.
+ * @param element   The element.
+ */
+template <typename Sink>
+template <typename T>
+void BufferedWriter<Sink>::format(const T& element, std::false_type)
+{
+    formatter.str(std::string());
+    formatter.clear();
+    formatter << element;
+    std::string text = formatter.str();
+    write(text.data(), text.size());
+}
+
+/**
+ * @brief   Formats an integer in decimal.
+ *
+ * @tparam Sink     The type of the sink.
+ * @param value     The magnitude of the integer.
+ * @param negative  True if the integer is negative.
+ */
+template <typename Sink>
+void BufferedWriter<Sink>::formatInteger(unsigned long long value, const bool negative)
+{
+    char digits[24];
+    char* first = digits + sizeof(digits);
+    do
+    {
+        *--first = (char)('0' + value % 10);
+        value /= 10;
+    } while(value != 0);
+    if(negative)
+        *--first = '-';
+    
+    write(first, (std::size_t)(digits + sizeof(digits) - first));
+}
+
+/** Formats a character as itself. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const char element)
+{
+    write(&element, 1);
+}
+
+/** Formats a null terminated string as itself. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const char* element)
+{
+    write(element);
+}
+
+/** Formats a string as itself. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const std::string& element)
+{
+    write(element.data(), element.size());
+}
+
+/** Formats a bool as 1 or 0. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const bool element)
+{
+    write(element ? "1" : "0", 1);
+}
+
+/** Formats a float with 6 significant digits. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const float element)
+{
+    formatDirectly((double)element);
+}
+
+/** Formats a double with 6 significant digits. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const double element)
+{
+    char text[32];
+    int length = std::snprintf(text, sizeof(text), "%g", element);
+    write(text, (std::size_t)length);
+}
+
+/** Formats a long double with 6 significant digits. */
+template <typename Sink>
+void BufferedWriter<Sink>::formatDirectly(const long double element)
+{
+    char text[64];
+    int length = std::snprintf(text, sizeof(text), "%Lg", element);
+    write(text, (std::size_t)length);
+}
+
+/** Formats a signed integer in decimal. */
+template <typename Sink>
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type BufferedWriter<Sink>::formatDirectly(const T element)
+{
+    if(sizeof(T) == 1)  // signed char is printed as a character.
+        write(reinterpret_cast<const char*>(&element), 1);
+    else if(element < 0)
+        formatInteger(0ULL - (unsigned long long)element, true);
+    else
+        formatInteger((unsigned long long)element, false);
+}
+
+/** Formats an unsigned integer in decimal. */
+template <typename Sink>
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type BufferedWriter<Sink>::formatDirectly(const T element)
+{
+    if(sizeof(T) == 1)  // unsigned char is printed as a character.
+        write(reinterpret_cast<const char*>(&element), 1);
+    else
+        formatInteger((unsigned long long)element, false);
+}
+
+} // namespace DataStructures
+
+#endif /* BufferedWriter_hpp */
@@ -0,0 +1,319 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ConcurrentBinaryTree.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic Binary Tree data structure that many threads can read while one thread updates it.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ConcurrentBinaryTree_hpp
+#define ConcurrentBinaryTree_hpp
+
+#include <mutex>
+#include <memory>
+#include <utility>
+#include "BinaryTree.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   ConcurrentBinaryTree
+ * @brief   A generic copy-on-write Binary Tree class for read mostly workloads.
+ * @details This Binary Tree is templated to use any data type or class (typename T). Readers work
+ *          on an immutable snapshot of a BinaryTree, which they pick up with a single atomic load
+ *          of a shared pointer, so a reader never waits for a writer. A writer copies the current
+ *          snapshot, changes the copy, and then publishes it with a single atomic store. Readers
+ *          that are still using the old snapshot finish on it, and the old snapshot is destroyed
+ *          by whichever thread lets go of it last.
+ * @tparam T    Any data type or class.
+ *
+ * @note    Every update copies the whole tree, so it only pays off when updates are rare.
+ *          Use update() or insertBulk() to apply many changes with a single copy.
+ */
+template <typename T>
+class ConcurrentBinaryTree
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    ConcurrentBinaryTree();
+    ConcurrentBinaryTree(const ConcurrentBinaryTree<T>& copyTree) = delete;
+    
+    // ----------- FUNCTIONS ------------
+    void insert(const T& element);
+    template <typename Iterator>
+    void insertBulk(Iterator first, Iterator last);
+    void remove(const T& element);
+    void invertTree();
+    void clear();
+    template <typename Function>
+    void update(Function change);
+    
+    bool bfsearch(const T& element);
+    bool parallelBfsearch(const T& element);
+    bool dfsearch(const T& element);
+    int depth(const T& element);
+    int height(const T& element);
+    int size();
+    bool empty();
+    std::shared_ptr<const BinaryTree<T>> snapshot();
+    
+    // ----------- OPERATORS ------------
+    ConcurrentBinaryTree<T>& operator=(const ConcurrentBinaryTree<T>& copyTree) = delete;
+    
+private:
+    // ------------- FIELDS -------------
+    std::shared_ptr<BinaryTree<T>> current; /**< The current snapshot. Never changed once it is published. */
+    std::mutex writerLock;                  /**< Makes writers take turns. Readers never take it. */
+    
+    // ----------- FUNCTIONS ------------
+    std::shared_ptr<BinaryTree<T>> load();
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Initializes this tree object with an empty snapshot.
+ */
+template <typename T>
+ConcurrentBinaryTree<T>::ConcurrentBinaryTree() : current(std::make_shared<BinaryTree<T>>()) {}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Inserts element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element you want to add to the tree.
+ *
+ * @details Publishes a new snapshot. No duplicates allowed.
+ */
+template <typename T>
+void ConcurrentBinaryTree<T>::insert(const T& element)
+{
+    update([&element](BinaryTree<T>& tree) { tree.insert(element); });
+}
+
+/**
+ * @brief   Inserts every element of a range into the tree in level order.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ *
+ * @details Publishes a single new snapshot that holds all the elements.
+ *          See BinaryTree::insertBulk(). No duplicates allowed.
+ */
+template <typename T>
+template <typename Iterator>
+void ConcurrentBinaryTree<T>::insertBulk(Iterator first, Iterator last)
+{
+    update([&first, &last](BinaryTree<T>& tree) { tree.insertBulk(first, last); });
+}
+
+/**
+ * @brief   Removes the specified element from the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element to be removed from the tree.
+ *
+ * @details Publishes a new snapshot.
+ */
+template <typename T>
+void ConcurrentBinaryTree<T>::remove(const T& element)
+{
+    update([&element](BinaryTree<T>& tree) { tree.remove(element); });
+}
+
+/**
+ * @brief   Inverts the tree.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Publishes a new snapshot.
+ */
+template <typename T>
+void ConcurrentBinaryTree<T>::invertTree()
+{
+    update([](BinaryTree<T>& tree) { tree.invertTree(); });
+}
+
+/**
+ * @brief   Clears the entire tree.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Publishes a new empty snapshot without copying the current one.
+ */
+template <typename T>
+void ConcurrentBinaryTree<T>::clear()
+{
+    std::lock_guard<std::mutex> lock(writerLock);
+    std::atomic_store(&current, std::make_shared<BinaryTree<T>>());
+}
+
+/**
+ * @brief   Applies a number of changes to the tree and publishes them all at once.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a reference to a BinaryTree.
+ * @param change    The function that changes the copy of the current snapshot.
+ *
+ * @details Readers see either none or all of the changes.
+ */
+template <typename T>
+template <typename Function>
+void ConcurrentBinaryTree<T>::update(Function change)
+{
+    std::lock_guard<std::mutex> lock(writerLock);
+    std::shared_ptr<BinaryTree<T>> next = std::make_shared<BinaryTree<T>>(*load());
+    change(*next);
+    std::atomic_store(&current, next);
+}
+
+/**
+ * @brief   Breadth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the current snapshot, otherwise returns false.
+ */
+template <typename T>
+bool ConcurrentBinaryTree<T>::bfsearch(const T& element)
+{
+    return load()->bfsearch(element);
+}
+
+/**
+ * @brief   Breadth First Search on several threads.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the current snapshot, otherwise returns false.
+ *          See BinaryTree::parallelBfsearch().
+ */
+template <typename T>
+bool ConcurrentBinaryTree<T>::parallelBfsearch(const T& element)
+{
+    return load()->parallelBfsearch(element);
+}
+
+/**
+ * @brief   Depth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the current snapshot, otherwise returns false.
+ */
+template <typename T>
+bool ConcurrentBinaryTree<T>::dfsearch(const T& element)
+{
+    return load()->dfsearch(element);
+}
+
+/**
+ * @brief   Returns depth of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose depth we are calculating.
+ * @return          Depth of element in the current snapshot, or -1 if the element is not in the tree.
+ */
+template <typename T>
+int ConcurrentBinaryTree<T>::depth(const T& element)
+{
+    return load()->depth(element);
+}
+
+/**
+ * @brief   Returns height of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @param element   The element whose height we are calculating.
+ * @return          Height of element in the current snapshot, or -1 if the element is not in the tree.
+ */
+template <typename T>
+int ConcurrentBinaryTree<T>::height(const T& element)
+{
+    return load()->height(element);
+}
+
+/**
+ * @brief   Returns the size of/number of nodes in the tree.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The size of the current snapshot.
+ */
+template <typename T>
+int ConcurrentBinaryTree<T>::size()
+{
+    return load()->size();
+}
+
+/**
+ * @brief   Returns true if the tree is empty and false otherwise.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A boolean flag.
+ */
+template <typename T>
+bool ConcurrentBinaryTree<T>::empty()
+{
+    return load()->empty();
+}
+
+/**
+ * @brief   Returns the current snapshot.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The current snapshot.
+ *
+ * @details Lets a reader run several queries against the same version of the tree,
+ *          for example forEachInorder(). Later updates do not change the returned snapshot.
+ */
+template <typename T>
+std::shared_ptr<const BinaryTree<T>> ConcurrentBinaryTree<T>::snapshot()
+{
+    return load();
+}
+
+/**
+ * @brief   Loads the current snapshot.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The current snapshot.
+ */
+template <typename T>
+std::shared_ptr<BinaryTree<T>> ConcurrentBinaryTree<T>::load()
+{
+    return std::atomic_load(&current);
+}
+
+} // namespace DataStructures
+
+#endif /* ConcurrentBinaryTree_hpp */
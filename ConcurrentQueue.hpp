@@ -0,0 +1,510 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ConcurrentQueue.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic lock-free multi-producer multi-consumer Queue data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ConcurrentQueue_hpp
+#define ConcurrentQueue_hpp
+
+#include <new>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include "NodePool.hpp"
+#include "HazardPointers.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @struct  QueueNode
+ * @brief   The QueueNode struct is meant to hold the data and an atomic pointer to the next queue element.
+ * @details The first node of the queue is a dummy node whose data was already dequeued (or never
+ *          existed), so the data lives in raw storage that is only constructed while it is queued.
+ *
+ * @tparam T    Any data type or class.
+ */
+template <typename T>
+struct QueueNode
+{
+    // ------------- FIELDS -------------
+    alignas(T) unsigned char storage[sizeof(T)];    /**< Raw storage for the data. */
+    std::atomic<QueueNode<T>*> next;    /**< Pointer to the next node in the queue. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Dummy Constructor. */
+    QueueNode() : next(nullptr) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    QueueNode(EmplaceTag, Args&&... args) : next(nullptr) { new (storage) T(std::forward<Args>(args)...); }
+    
+    // ----------- FUNCTIONS ------------
+    /** Returns the data. */
+    T& data() { return *reinterpret_cast<T*>(storage); }
+};
+
+/**
+ * @class   ConcurrentQueue
+ * @brief   A generic lock-free FIFO Queue class (Michael-Scott queue).
+ * @details This Queue class is templated to use any data type or class. Any number of threads can
+ *          enqueue and dequeue at the same time without a lock. Like SLinkedList it keeps a head and
+ *          a tail and links its nodes through next, elements are added at the tail and taken from
+ *          the head. The head and the tail sit on separate cache lines, so producers and consumers
+ *          do not slow each other down through false sharing. Dequeued nodes are retired through
+ *          HazardPointers, so no thread can read a deleted node and the ABA problem cannot occur.
+ *          The queue can optionally be bounded, then producers are held back while the queue is full.
+ * @tparam T    Any data type or class.
+ *
+ * @note    The nodes are allocated with new instead of a NodePool, because a NodePool is not thread safe.
+ */
+template <typename T>
+class ConcurrentQueue
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    ConcurrentQueue();
+    explicit ConcurrentQueue(const int maximumSize);
+    ConcurrentQueue(const ConcurrentQueue<T>& copyQueue) = delete;
+    ~ConcurrentQueue();
+    
+    // ----------- FUNCTIONS ------------
+    void enqueue(const T& data);
+    void enqueue(T&& data);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    bool tryEnqueue(const T& data);
+    bool tryEnqueue(T&& data);
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+    bool tryDequeue(T& out);
+    template <typename OutputIterator>
+    int dequeueBulk(OutputIterator out, const int maximumCount);
+    int size();
+    bool empty();
+    int capacity();
+    
+    // ----------- OPERATORS ------------
+    ConcurrentQueue<T>& operator=(const ConcurrentQueue<T>& copyQueue) = delete;
+    
+private:
+    // -------------- TYPES -------------
+    /** Finishes a dequeue once the element was moved out of its node, also if the move throws. */
+    struct DequeueFinisher
+    {
+        ConcurrentQueue<T>* queue;  /**< The queue the element was removed from. */
+        QueueNode<T>* first;        /**< The old dummy node, which is retired. */
+        QueueNode<T>* next;         /**< The new dummy node, whose element is destroyed. */
+        ~DequeueFinisher()
+        {
+            next->data().~T();
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            HazardPointers::retire(first);
+            queue->queueSize.fetch_sub(1, std::memory_order_release);
+        }
+    };
+    
+    // ------------- FIELDS -------------
+    alignas(64) std::atomic<QueueNode<T>*> head;    /**< The dummy node in front of the first element. */
+    alignas(64) std::atomic<QueueNode<T>*> tail;    /**< The last node, or a node shortly before it. */
+    alignas(64) std::atomic<int> queueSize;         /**< The number of elements, including the ones being enqueued. */
+    int queueCapacity;                              /**< The maximum number of elements, or 0 if the queue is unbounded. */
+    
+    // ----------- FUNCTIONS ------------
+    bool reserve();
+    template <typename... Args>
+    void linkNewNode(Args&&... args);
+    void linkNode(QueueNode<T>* node);
+    template <typename Receiver>
+    bool dequeueInto(Receiver receive);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Initializes an unbounded queue that only holds its dummy node.
+ */
+template <typename T>
+ConcurrentQueue<T>::ConcurrentQueue() : ConcurrentQueue(0) {}
+
+/**
+ * @brief   Bounded Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @param maximumSize   The maximum number of elements in the queue, or 0 for an unbounded queue.
+ *
+ * @details Initializes a queue that only holds its dummy node.
+ */
+template <typename T>
+ConcurrentQueue<T>::ConcurrentQueue(const int maximumSize) : head(nullptr), tail(nullptr), queueSize(0), queueCapacity(maximumSize < 0 ? 0 : maximumSize)
+{
+    QueueNode<T>* dummy = new QueueNode<T>();
+    head.store(dummy, std::memory_order_relaxed);
+    tail.store(dummy, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Destroys every element that is still in the queue and deletes every node.
+ *
+ * @warning No other thread may use the queue while it is destroyed.
+ */
+template <typename T>
+ConcurrentQueue<T>::~ConcurrentQueue()
+{
+    QueueNode<T>* node = head.load(std::memory_order_acquire);
+    bool dummy = true;
+    while(node != nullptr)
+    {
+        QueueNode<T>* next = node->next.load(std::memory_order_relaxed);
+        if(!dummy)
+            node->data().~T();
+        delete node;
+        node = next;
+        dummy = false;
+    }
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds a new element to the back of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be added.
+ *
+ * @details If the queue is bounded and full, waits until a consumer makes room.
+ */
+template <typename T>
+void ConcurrentQueue<T>::enqueue(const T& data)
+{
+    emplace(data);
+}
+
+/**
+ * @brief   Moves a new element to the back of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be moved into the queue.
+ *
+ * @details If the queue is bounded and full, waits until a consumer makes room.
+ */
+template <typename T>
+void ConcurrentQueue<T>::enqueue(T&& data)
+{
+    emplace(std::move(data));
+}
+
+/**
+ * @brief   Constructs a new element in place at the back of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ *
+ * @details If the queue is bounded and full, waits until a consumer makes room.
+ */
+template <typename T>
+template <typename... Args>
+void ConcurrentQueue<T>::emplace(Args&&... args)
+{
+    while(!reserve())
+        std::this_thread::yield();
+    
+    linkNewNode(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief   Adds a new element to the back of the queue if there is room for it.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be added.
+ * @return      True if the element was added, false if the queue is bounded and full.
+ */
+template <typename T>
+bool ConcurrentQueue<T>::tryEnqueue(const T& data)
+{
+    return tryEmplace(data);
+}
+
+/**
+ * @brief   Moves a new element to the back of the queue if there is room for it.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be moved into the queue.
+ * @return      True if the element was moved, false if the queue is bounded and full.
+ *
+ * @note    The element is left untouched if the queue is full.
+ */
+template <typename T>
+bool ConcurrentQueue<T>::tryEnqueue(T&& data)
+{
+    return tryEmplace(std::move(data));
+}
+
+/**
+ * @brief   Constructs a new element in place at the back of the queue if there is room for it.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ * @return      True if the element was added, false if the queue is bounded and full.
+ */
+template <typename T>
+template <typename... Args>
+bool ConcurrentQueue<T>::tryEmplace(Args&&... args)
+{
+    if(!reserve())
+        return false;
+    
+    linkNewNode(std::forward<Args>(args)...);
+    return true;
+}
+
+/**
+ * @brief   Removes the element at the front of the queue without throwing.
+ *
+ * @tparam T    Any data type or class.
+ * @param out   Receives the element that was at the front of the queue.
+ * @return      True if an element was removed, false if the queue was empty.
+ *
+ * @note    If moving the element into out throws, the element is lost, but it is still removed from the queue.
+ */
+template <typename T>
+bool ConcurrentQueue<T>::tryDequeue(T& out)
+{
+    return dequeueInto([&out](T& data) { out = std::move(data); });
+}
+
+/**
+ * @brief   Removes up to a number of elements from the front of the queue.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam OutputIterator   An output iterator that accepts elements of type T.
+ * @param out               Receives the removed elements, in queue order.
+ * @param maximumCount      The maximum number of elements to remove.
+ * @return                  The number of elements that were removed.
+ *
+ * @details Stops early when the queue runs empty. Other consumers may take elements
+ *          in between, so the removed elements are not always consecutive in the queue.
+ *
+ * @note    If moving an element into out throws, that element is lost, but it is still removed from the queue.
+ */
+template <typename T>
+template <typename OutputIterator>
+int ConcurrentQueue<T>::dequeueBulk(OutputIterator out, const int maximumCount)
+{
+    int count = 0;
+    auto receive = [&out](T& data) { *out = std::move(data); ++out; };
+    while(count < maximumCount && dequeueInto(receive))
+        count++;
+    
+    return count;
+}
+
+/**
+ * @brief   Returns the size of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The size of the queue.
+ *
+ * @note    The size is only approximate while other threads enqueue or dequeue.
+ */
+template <typename T>
+int ConcurrentQueue<T>::size()
+{
+    return queueSize.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Returns true if the queue is empty and false otherwise.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A boolean flag.
+ *
+ * @note    Other threads may enqueue or dequeue right after this returns.
+ */
+template <typename T>
+bool ConcurrentQueue<T>::empty()
+{
+    QueueNode<T>* first = HazardPointers::protect(0, head);
+    bool isEmpty = first->next.load(std::memory_order_acquire) == nullptr;
+    HazardPointers::clear(0);
+    return isEmpty;
+}
+
+/**
+ * @brief   Returns the maximum number of elements in the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The capacity of the queue, or 0 if the queue is unbounded.
+ */
+template <typename T>
+int ConcurrentQueue<T>::capacity()
+{
+    return queueCapacity;
+}
+
+/**
+ * @brief   Reserves room for one more element.
+ *
+ * @tparam T    Any data type or class.
+ * @return      True if there was room, false if the queue is bounded and full.
+ */
+template <typename T>
+bool ConcurrentQueue<T>::reserve()
+{
+    if(queueCapacity == 0)
+    {
+        queueSize.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    
+    int currentSize = queueSize.load(std::memory_order_relaxed);
+    do
+    {
+        if(currentSize >= queueCapacity)
+            return false;
+    }
+    while(!queueSize.compare_exchange_weak(currentSize, currentSize + 1, std::memory_order_acquire, std::memory_order_relaxed));
+    
+    return true;
+}
+
+/**
+ * @brief   Constructs a new node for the room reserved with reserve() and links it at the back of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ *
+ * @details If the allocation or the constructor of the element throws, the reserved room is given
+ *          back before the exception is passed on, so a bounded queue keeps its capacity.
+ */
+template <typename T>
+template <typename... Args>
+void ConcurrentQueue<T>::linkNewNode(Args&&... args)
+{
+    QueueNode<T>* node;
+    try
+    {
+        node = new QueueNode<T>(EmplaceTag(), std::forward<Args>(args)...);
+    }
+    catch(...)  // Give the reserved room back if the node cannot be created.
+    {
+        queueSize.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    
+    linkNode(node);
+}
+
+/**
+ * @brief   Links a node at the back of the queue.
+ *
+ * @tparam T    Any data type or class.
+ * @param node  The node to link. No other thread can see it yet.
+ *
+ * @details The node is linked after the last node first, and the tail is moved to it afterwards.
+ *          A producer that finds the tail behind the last node moves it forward before trying again.
+ */
+template <typename T>
+void ConcurrentQueue<T>::linkNode(QueueNode<T>* node)
+{
+    while(true)
+    {
+        QueueNode<T>* last = HazardPointers::protect(0, tail);
+        QueueNode<T>* next = last->next.load(std::memory_order_acquire);
+        if(last != tail.load(std::memory_order_acquire))
+            continue;
+        
+        if(next != nullptr)     // The tail fell behind, help move it forward.
+        {
+            tail.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+        
+        if(last->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+            tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+            break;
+        }
+    }
+    HazardPointers::clear(0);
+}
+
+/**
+ * @brief   Removes the element at the front of the queue and hands it to a receiver.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Receiver A callable that takes a reference to the element and moves it out.
+ * @param receive   The function called with the removed element.
+ * @return          True if an element was removed, false if the queue was empty.
+ *
+ * @details The head is moved one node forward, and the node that held the element becomes
+ *          the new dummy node. Both nodes are protected with hazard pointers while they are read.
+ *          Once the head moved, the element is destroyed, the old dummy node retired and the size
+ *          decremented on every path, also if the receiver throws.
+ */
+template <typename T>
+template <typename Receiver>
+bool ConcurrentQueue<T>::dequeueInto(Receiver receive)
+{
+    while(true)
+    {
+        QueueNode<T>* first = HazardPointers::protect(0, head);
+        QueueNode<T>* next = HazardPointers::protect(1, first->next);
+        if(first != head.load(std::memory_order_acquire))   // The head moved while next was loaded.
+            continue;
+        
+        if(next == nullptr)     // Only the dummy node is left.
+        {
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            return false;
+        }
+        
+        QueueNode<T>* last = tail.load(std::memory_order_acquire);
+        if(first == last)       // The tail fell behind, help the producer move it forward.
+        {
+            tail.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+        
+        if(head.compare_exchange_strong(first, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            DequeueFinisher finisher = {this, first, next};
+            receive(next->data());
+            return true;
+        }
+    }
+}
+
+} // namespace DataStructures
+
+#endif /* ConcurrentQueue_hpp */
@@ -0,0 +1,280 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ConcurrentStack.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic lock-free Stack data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ConcurrentStack_hpp
+#define ConcurrentStack_hpp
+
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+#include "Stack.hpp"
+#include "HazardPointers.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   ConcurrentStack
+ * @brief   A generic lock-free Stack class (Treiber stack).
+ * @details This Stack class is templated to use any data type or class. Any number of threads
+ *          can push and pop at the same time without a lock. The nodes are the same StackNode<T>
+ *          that Stack uses, linked through previous, and the top of the stack is swapped in
+ *          with a single compare-and-swap. A popped node is retired through HazardPointers,
+ *          so no thread can read a deleted node and the ABA problem cannot occur.
+ * @tparam T    Any data type or class.
+ *
+ * @note    The nodes are allocated with new instead of a NodePool, because a NodePool is not thread safe.
+ */
+template <typename T>
+class ConcurrentStack
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    ConcurrentStack();
+    ConcurrentStack(const ConcurrentStack<T>& copyStack) = delete;
+    ~ConcurrentStack();
+    
+    // ----------- FUNCTIONS ------------
+    void push(const T& data);
+    void push(T&& data);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    T pop();
+    bool tryPop(T& out);
+    int size();
+    bool empty();
+    
+    // ----------- OPERATORS ------------
+    ConcurrentStack<T>& operator=(const ConcurrentStack<T>& copyStack) = delete;
+    
+private:
+    // -------------- TYPES -------------
+    /** Retires a popped node once the element was moved out of it, also if the move throws. */
+    struct NodeRetirer
+    {
+        StackNode<T>* node;     /**< The popped node. */
+        ~NodeRetirer() { HazardPointers::retire(node); }
+    };
+    
+    // ------------- FIELDS -------------
+    alignas(64) std::atomic<StackNode<T>*> top;  /**< The top of the stack. */
+    alignas(64) std::atomic<int> stackSize;      /**< The size of the stack, kept on its own cache line. */
+    
+    // ----------- FUNCTIONS ------------
+    void pushNode(StackNode<T>* node);
+    StackNode<T>* popNode();
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Initializes this stack object with a nullptr top and size of 0;
+ */
+template <typename T>
+ConcurrentStack<T>::ConcurrentStack() : top(nullptr), stackSize(0) {}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Deletes every node that is still in the stack.
+ *
+ * @warning No other thread may use the stack while it is destroyed.
+ */
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack()
+{
+    StackNode<T>* node = top.load(std::memory_order_acquire);
+    while(node != nullptr)
+    {
+        StackNode<T>* previous = node->previous;
+        delete node;
+        node = previous;
+    }
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Pushes a new element onto the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be pushed.
+ */
+template <typename T>
+void ConcurrentStack<T>::push(const T& data)
+{
+    pushNode(new StackNode<T>(data));
+}
+
+/**
+ * @brief   Moves a new element onto the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element that will be moved onto the stack.
+ */
+template <typename T>
+void ConcurrentStack<T>::push(T&& data)
+{
+    pushNode(new StackNode<T>(std::move(data)));
+}
+
+/**
+ * @brief   Constructs a new element in place on top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ */
+template <typename T>
+template <typename... Args>
+void ConcurrentStack<T>::emplace(Args&&... args)
+{
+    pushNode(new StackNode<T>(EmplaceTag(), std::forward<Args>(args)...));
+}
+
+/**
+ * @brief   Pops an element off the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The element that was on top of the stack.
+ *
+ * @throw   underflow_error If the stack is empty.
+ * @note    If moving the element out of its node throws, the element is lost, but its node is still retired.
+ */
+template <typename T>
+T ConcurrentStack<T>::pop()
+{
+    StackNode<T>* node = popNode();
+    if(node == nullptr)
+        throw std::underflow_error("Stack is Empty");
+    
+    NodeRetirer retirer = {node};
+    T data(std::move(node->data));
+    return data;
+}
+
+/**
+ * @brief   Pops an element off the stack without throwing.
+ *
+ * @tparam T    Any data type or class.
+ * @param out   Receives the element that was on top of the stack.
+ * @return      True if an element was popped, false if the stack was empty.
+ *
+ * @note    If moving the element into out throws, the element is lost, but its node is still retired.
+ */
+template <typename T>
+bool ConcurrentStack<T>::tryPop(T& out)
+{
+    StackNode<T>* node = popNode();
+    if(node == nullptr)
+        return false;
+    
+    NodeRetirer retirer = {node};
+    out = std::move(node->data);
+    return true;
+}
+
+/**
+ * @brief   Returns the size of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The size of the stack.
+ *
+ * @note    The size is only approximate while other threads push or pop.
+ */
+template <typename T>
+int ConcurrentStack<T>::size()
+{
+    int currentSize = stackSize.load(std::memory_order_relaxed);
+    return (currentSize < 0) ? 0 : currentSize;
+}
+
+/**
+ * @brief   Returns true if the stack is empty and false otherwise.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A boolean flag.
+ *
+ * @note    Other threads may push or pop right after this returns.
+ */
+template <typename T>
+bool ConcurrentStack<T>::empty()
+{
+    return top.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * @brief   Links a node on top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @param node  The node to link. No other thread can see it yet.
+ */
+template <typename T>
+void ConcurrentStack<T>::pushNode(StackNode<T>* node)
+{
+    stackSize.fetch_add(1, std::memory_order_relaxed);
+    node->previous = top.load(std::memory_order_relaxed);
+    while(!top.compare_exchange_weak(node->previous, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief   Unlinks the node on top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The unlinked node, or nullptr if the stack was empty.
+ *
+ * @details The top node is protected with a hazard pointer before its previous link is read,
+ *          so the node cannot be deleted, or reused by another push, while the swap is attempted.
+ *          The caller owns the returned node and has to retire it.
+ */
+template <typename T>
+StackNode<T>* ConcurrentStack<T>::popNode()
+{
+    StackNode<T>* node;
+    while(true)
+    {
+        node = HazardPointers::protect(0, top);
+        if(node == nullptr)
+            break;
+        
+        StackNode<T>* expected = node;
+        if(top.compare_exchange_weak(expected, node->previous, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            stackSize.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+    HazardPointers::clear(0);
+    
+    return node;
+}
+
+} // namespace DataStructures
+
+#endif /* ConcurrentStack_hpp */
@@ -0,0 +1,351 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ContainerStats.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The operation counters and memory statistics that the node based data structures
+ *          keep when they are built with DATASTRUCTURES_STATS defined.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ContainerStats_hpp
+#define ContainerStats_hpp
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+namespace DataStructures
+{
+
+/**
+ * @class   ContainerStats
+ * @brief   Counts what the operations of a single data structure cost.
+ * @details Counts the nodes allocated and freed, the bytes held, and for every instrumented operation
+ *          the number of calls, the nodes traversed, the high-water mark of the breadth first queue
+ *          and a histogram of the latencies. Latency bucket i counts the calls that took less than
+ *          2^(i+1) nanoseconds and at least 2^i nanoseconds, the last bucket counts everything slower.
+ *
+ *          The data structures only keep statistics when DATASTRUCTURES_STATS is defined before they
+ *          are included, for example with -DDATASTRUCTURES_STATS. Without it they hold no statistics
+ *          and have no stats() function, so the instrumentation costs nothing.
+ *
+ * @note    The counters are relaxed atomics, so the threads that read a data structure at the same
+ *          time, for example with bfsearch() on a snapshot, can count their calls without a data race.
+ *          Counts read while other threads are still counting may be slightly behind.
+ */
+class ContainerStats
+{
+public:
+    // -------------- TYPES -------------
+    /** The operations that are counted. */
+    enum Operation
+    {
+        SUBSCRIPT,  /**< operator[]. */
+        INSERT,     /**< insert() and emplace(). */
+        REMOVE,     /**< remove(). */
+        SEARCH,     /**< bfsearch(). */
+        PUSH,       /**< push() and emplace() of a stack. */
+        POP         /**< pop() of a stack. */
+    };
+    
+    // ----------- CONSTANTS ------------
+    static const int OPERATION_COUNT = 6;   /**< The number of operations that are counted. */
+    static const int LATENCY_BUCKETS = 32;  /**< The number of latency buckets, the last one starts at about 2 seconds. */
+    
+    /**
+     * @struct  OperationStats
+     * @brief   The statistics of one operation.
+     */
+    struct OperationStats
+    {
+        std::atomic<long long> calls;                       /**< The number of calls. */
+        std::atomic<long long> nodesTraversed;              /**< The number of nodes stepped over or visited by all calls. */
+        std::atomic<int> queueHighWater;                    /**< The most nodes a single call kept in its breadth first queue. */
+        std::atomic<long long> latencies[LATENCY_BUCKETS];  /**< The number of calls in every latency bucket. */
+    };
+    
+    /**
+     * @class   Timer
+     * @brief   Counts a call of an operation and adds its latency to the histogram when it goes out of scope.
+     */
+    class Timer
+    {
+    public:
+        Timer(ContainerStats& stats, const Operation operation);
+        ~Timer();
+        Timer(const Timer& copyTimer) = delete;
+        Timer& operator=(const Timer& copyTimer) = delete;
+        
+    private:
+        ContainerStats& stats;                              /**< The statistics the call is counted in. */
+        Operation operation;                                /**< The operation that is timed. */
+        std::chrono::steady_clock::time_point start;        /**< When the call started. */
+    };
+    
+    // ---------- CONSTRUCTORS ----------
+    ContainerStats();
+    ContainerStats(const ContainerStats& copyStats) = delete;
+    
+    // ----------- FUNCTIONS ------------
+    void recordAllocation();
+    void recordFree();
+    void recordBytesHeld(const long long bytes);
+    void recordTraversal(const Operation operation, const long long nodes);
+    void recordQueueSize(const Operation operation, const int queueSize);
+    void recordLatency(const Operation operation, const long long nanoseconds);
+    long long allocations() const;
+    long long frees() const;
+    long long bytesHeld() const;
+    const OperationStats& operation(const Operation operation) const;
+    void reset();
+    static const char* operationName(const Operation operation);
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    friend std::ostream& operator<<(std::ostream& output, const ContainerStats& stats);
+    
+private:
+    // ------------- FIELDS -------------
+    std::atomic<long long> allocationCount;         /**< The number of nodes allocated. */
+    std::atomic<long long> freeCount;               /**< The number of nodes freed. */
+    std::atomic<long long> heldBytes;               /**< The bytes held when the statistics were last read. */
+    OperationStats operations[OPERATION_COUNT];     /**< The statistics of every operation. */
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @details Starts every counter at 0.
+ */
+inline ContainerStats::ContainerStats()
+{
+    reset();
+}
+
+/**
+ * @brief   Timer Constructor.
+ *
+ * @param stats     The statistics the call is counted in.
+ * @param operation The operation that is timed.
+ */
+inline ContainerStats::Timer::Timer(ContainerStats& stats, const Operation operation) : stats(stats), operation(operation), start(std::chrono::steady_clock::now()) {}
+
+/**
+ * @brief   Timer Destructor.
+ *
+ * @details Counts the call, and adds the time since the timer was created to the latency histogram.
+ */
+inline ContainerStats::Timer::~Timer()
+{
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    stats.recordLatency(operation, (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Counts a node that was allocated.
+ */
+inline void ContainerStats::recordAllocation()
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Counts a node that was freed.
+ */
+inline void ContainerStats::recordFree()
+{
+    freeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Records the bytes the data structure currently holds.
+ *
+ * @param bytes The bytes held by the nodes and the other buffers of the data structure.
+ */
+inline void ContainerStats::recordBytesHeld(const long long bytes)
+{
+    heldBytes.store(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Counts the nodes that a call of an operation traversed.
+ *
+ * @param operation The operation.
+ * @param nodes     The number of nodes the call stepped over or visited.
+ */
+inline void ContainerStats::recordTraversal(const Operation operation, const long long nodes)
+{
+    operations[operation].nodesTraversed.fetch_add(nodes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Records the size of the breadth first queue of an operation, keeping the largest size.
+ *
+ * @param operation The operation.
+ * @param queueSize The number of nodes in the queue.
+ */
+inline void ContainerStats::recordQueueSize(const Operation operation, const int queueSize)
+{
+    std::atomic<int>& highWater = operations[operation].queueHighWater;
+    int current = highWater.load(std::memory_order_relaxed);
+    while(queueSize > current && !highWater.compare_exchange_weak(current, queueSize, std::memory_order_relaxed))
+        ;   // current was reloaded, try again while queueSize is still larger.
+}
+
+/**
+ * @brief   Counts a call of an operation and adds its latency to the histogram.
+ *
+ * @param operation     The operation.
+ * @param nanoseconds   How long the call took.
+ */
+inline void ContainerStats::recordLatency(const Operation operation, const long long nanoseconds)
+{
+    int bucket = 0;
+    for(long long remaining = nanoseconds; remaining > 1 && bucket < LATENCY_BUCKETS-1; remaining >>= 1)
+        bucket++;
+    
+    operations[operation].calls.fetch_add(1, std::memory_order_relaxed);
+    operations[operation].latencies[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Returns the number of nodes allocated.
+ *
+ * @return  The number of nodes allocated since the statistics were created or reset.
+ */
+inline long long ContainerStats::allocations() const
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Returns the number of nodes freed.
+ *
+ * @return  The number of nodes freed since the statistics were created or reset.
+ */
+inline long long ContainerStats::frees() const
+{
+    return freeCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Returns the bytes held.
+ *
+ * @return  The bytes the data structure held when its stats() function was last called.
+ */
+inline long long ContainerStats::bytesHeld() const
+{
+    return heldBytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Returns the statistics of an operation.
+ *
+ * @param operation The operation.
+ * @return          The statistics of the operation.
+ */
+inline const ContainerStats::OperationStats& ContainerStats::operation(const Operation operation) const
+{
+    return operations[operation];
+}
+
+/**
+ * @brief   Sets every counter back to 0.
+ */
+inline void ContainerStats::reset()
+{
+    allocationCount.store(0, std::memory_order_relaxed);
+    freeCount.store(0, std::memory_order_relaxed);
+    heldBytes.store(0, std::memory_order_relaxed);
+    for(int i = 0; i < OPERATION_COUNT; i++)
+    {
+        operations[i].calls.store(0, std::memory_order_relaxed);
+        operations[i].nodesTraversed.store(0, std::memory_order_relaxed);
+        operations[i].queueHighWater.store(0, std::memory_order_relaxed);
+        for(int bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+            operations[i].latencies[bucket].store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief   Returns the name of an operation.
+ *
+ * @param operation The operation.
+ * @return          The name, as it is printed by operator<<.
+ */
+inline const char* ContainerStats::operationName(const Operation operation)
+{
+    static const char* const names[OPERATION_COUNT] = {"subscript", "insert", "remove", "search", "push", "pop"};
+    return names[operation];
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @param output    The output stream.
+ * @param stats     The statistics to print.
+ * @return          The output stream.
+ *
+ * @details Prints one "name value" pair per line, so the statistics can be scraped into a metrics
+ *          system. Only the operations that were called are printed, and only their non-empty
+ *          latency buckets, named by the upper bound of the bucket in nanoseconds.
+ */
+inline std::ostream& operator<<(std::ostream& output, const ContainerStats& stats)
+{
+    output << "allocations " << stats.allocations() << "\n";
+    output << "frees " << stats.frees() << "\n";
+    output << "bytes_held " << stats.bytesHeld() << "\n";
+    for(int i = 0; i < ContainerStats::OPERATION_COUNT; i++)
+    {
+        const ContainerStats::OperationStats& operation = stats.operations[i];
+        long long calls = operation.calls.load(std::memory_order_relaxed);
+        if(calls == 0)
+            continue;
+        
+        const char* name = ContainerStats::operationName((ContainerStats::Operation)i);
+        output << name << ".calls " << calls << "\n";
+        output << name << ".nodes_traversed " << operation.nodesTraversed.load(std::memory_order_relaxed) << "\n";
+        output << name << ".queue_high_water " << operation.queueHighWater.load(std::memory_order_relaxed) << "\n";
+        for(int bucket = 0; bucket < ContainerStats::LATENCY_BUCKETS; bucket++)
+        {
+            long long latencies = operation.latencies[bucket].load(std::memory_order_relaxed);
+            if(latencies == 0)
+                continue;
+            
+            output << name << ".latency_ns_";
+            if(bucket == ContainerStats::LATENCY_BUCKETS-1)
+                output << "inf ";
+            else
+                output << "lt_" << (2LL << bucket) << " ";
+            output << latencies << "\n";
+        }
+    }
+    
+    return output;
+}
+
+} // namespace DataStructures
+
+#endif /* ContainerStats_hpp */
@@ -0,0 +1,271 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    CopyOnWrite.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A holder that takes snapshots of a data structure in constant time and copies it lazily.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef CopyOnWrite_hpp
+#define CopyOnWrite_hpp
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace DataStructures
+{
+
+/**
+ * @class   CopyOnWrite
+ * @brief   A generic copy-on-write holder for any data structure, like a BinaryTree or a DLinkedList.
+ * @details The holder keeps its data structure behind a shared pointer. snapshot() and the copy
+ *          constructor only share that pointer, so they take constant time however large the data
+ *          structure is. The data structure is only copied when update() changes it while it is
+ *          shared, so a snapshot costs at most one copy, made by the first update after it, and
+ *          updates in between snapshots change the data structure in place. A snapshot never
+ *          changes, and it is destroyed by whichever thread lets go of it last.
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ *
+ * @note    A holder itself must be used by one thread at a time. The snapshots it returns can be
+ *          read by any number of threads, also while the holder is updated, through the constant
+ *          functions of the data structure, when those only read it. The constant functions of
+ *          BinaryTree, DLinkedList, SLinkedList and Stack do, including bfsearch() and parallelBfsearch()
+ *          of a BinaryTree, peek(index) of a DLinkedList, and writeTo() and operator<< of all four as long
+ *          as every thread writes to a sink of its own. Their statistics, kept when DATASTRUCTURES_STATS
+ *          is defined, are atomic. The data structure must not share its node pool with other data
+ *          structures, since the pool is not thread safe. Copies made by update() always start with a
+ *          pool of their own.
+ *
+ * @note    The nodes are shared by the whole data structure, not one by one, so the first update after
+ *          a snapshot copies every node. Use update() to apply many changes with that single copy.
+ */
+template <typename Container>
+class CopyOnWrite
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    CopyOnWrite();
+    explicit CopyOnWrite(const Container& container);
+    explicit CopyOnWrite(Container&& container);
+    CopyOnWrite(const CopyOnWrite<Container>& copyHolder);
+    
+    // ----------- FUNCTIONS ------------
+    template <typename Function>
+    void update(Function change);
+    void clear();
+    const Container& read() const;
+    std::shared_ptr<const Container> snapshot() const;
+    bool shared() const;
+    
+    // ----------- OPERATORS ------------
+    CopyOnWrite<Container>& operator=(const CopyOnWrite<Container>& copyHolder);
+    const Container* operator->() const;
+    
+private:
+    // ------------- FIELDS -------------
+    std::shared_ptr<Container> current; /**< The data structure. Never changed while it is shared. */
+    
+    // ----------- FUNCTIONS ------------
+    Container& unshare();
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ *
+ * @details Initializes this holder with an empty data structure.
+ */
+template <typename Container>
+CopyOnWrite<Container>::CopyOnWrite() : current(std::make_shared<Container>()) {}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @param container     The data structure this holder starts with a copy of.
+ */
+template <typename Container>
+CopyOnWrite<Container>::CopyOnWrite(const Container& container) : current(std::make_shared<Container>(container)) {}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @param container     The data structure whose contents will be moved into this holder.
+ *
+ * @details Takes over the nodes of the provided data structure without copying them.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename Container>
+CopyOnWrite<Container>::CopyOnWrite(Container&& container) : current(std::make_shared<Container>(std::move(container))) {}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @param copyHolder    The holder whose data structure this holder shares.
+ *
+ * @details Takes constant time. Both holders share the data structure until either of them
+ *          is updated, which copies it for the updated holder only.
+ */
+template <typename Container>
+CopyOnWrite<Container>::CopyOnWrite(const CopyOnWrite<Container>& copyHolder) : current(copyHolder.current) {}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Applies a number of changes to the data structure.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @tparam Function     A callable that takes a reference to a Container.
+ * @param change        The function that changes the data structure.
+ *
+ * @details Copies the data structure first if a snapshot or another holder still shares it,
+ *          otherwise changes it in place. The snapshots taken before never see the changes.
+ *
+ * @warning The reference passed to change() must not be kept, since it may point to a data structure
+ *          that is shared by a later snapshot.
+ * @note    If change() throws an exception, the holder keeps the changes made until then,
+ *          but the snapshots are unchanged.
+ */
+template <typename Container>
+template <typename Function>
+void CopyOnWrite<Container>::update(Function change)
+{
+    change(unshare());
+}
+
+/**
+ * @brief   Clears the data structure.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ *
+ * @details Clears the data structure in place, or starts a new empty one without copying if it is shared.
+ */
+template <typename Container>
+void CopyOnWrite<Container>::clear()
+{
+    if(shared())
+        current = std::make_shared<Container>();
+    else
+        unshare().clear();
+}
+
+/**
+ * @brief   Returns the data structure for reading.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @return              A constant reference to the data structure.
+ *
+ * @warning The reference is only valid until the next update() or clear() of this holder.
+ *          Use snapshot() to keep reading the current version.
+ */
+template <typename Container>
+const Container& CopyOnWrite<Container>::read() const
+{
+    return *current;
+}
+
+/**
+ * @brief   Returns a snapshot of the data structure.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @return              The current version of the data structure, shared in constant time.
+ *
+ * @details Later updates of this holder do not change the returned snapshot.
+ */
+template <typename Container>
+std::shared_ptr<const Container> CopyOnWrite<Container>::snapshot() const
+{
+    return current;
+}
+
+/**
+ * @brief   Returns true if a snapshot or another holder shares the data structure.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @return              A boolean flag.
+ *
+ * @details The next update() copies the data structure only if this returns true.
+ */
+template <typename Container>
+bool CopyOnWrite<Container>::shared() const
+{
+    return current.use_count() != 1;
+}
+
+/**
+ * @brief   Returns the data structure for changing it, copying it first if it is shared.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @return              A reference to a data structure that nothing else shares.
+ */
+template <typename Container>
+Container& CopyOnWrite<Container>::unshare()
+{
+    if(shared())
+        current = std::make_shared<Container>(*current);
+    else    // Sees everything the threads that let go of their snapshots did with the data structure.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    
+    return *current;
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @param copyHolder    The holder whose data structure this holder shares.
+ * @return              A reference to this holder.
+ *
+ * @details Takes constant time, like the copy constructor.
+ */
+template <typename Container>
+CopyOnWrite<Container>& CopyOnWrite<Container>::operator=(const CopyOnWrite<Container>& copyHolder)
+{
+    current = copyHolder.current;
+    return *this;
+}
+
+/**
+ * @brief   Member access operator.
+ *
+ * @tparam Container    Any data structure with a default constructor and a copy constructor.
+ * @return              A constant pointer to the data structure.
+ *
+ * @details Calls a constant function of the data structure, for example holder->size().
+ *          The same as read().
+ */
+template <typename Container>
+const Container* CopyOnWrite<Container>::operator->() const
+{
+    return current.get();
+}
+
+} // namespace DataStructures
+
+#endif /* CopyOnWrite_hpp */
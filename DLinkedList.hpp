@@ -14,80 +14,236 @@
 #ifndef DLinkedList_hpp
 #define DLinkedList_hpp
 
+#include <memory>
+#include <initializer_list>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <vector>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include "NodeStorage.hpp"
+#include "Serialization.hpp"
+#include "BufferedWriter.hpp"
+#include "ParallelAlgorithms.hpp"
+
+namespace DataStructures
+{
 
 /**
- * @struct  Node
- * @brief   The Node struct is meant to hold the data and pointers to the previous and next list element.
+ * @struct  DListNode
+ * @brief   The DListNode struct is meant to hold the data and pointers to the previous and next list element.
  *
  * @tparam T    Any data type or class.
  */
 template <typename T>
-struct Node
+struct DListNode
 {
     // ------------- FIELDS -------------
-    T data;             /**< The data. */
-    Node<T>* next;      /**< Pointer to the next node in the list. */
-    Node<T>* previous;  /**< Pointer to the previous node in the list. */
+    T data;                  /**< The data. */
+    DListNode<T>* next;      /**< Pointer to the next node in the list. */
+    DListNode<T>* previous;  /**< Pointer to the previous node in the list. */
     
     // ---------- CONSTRUCTORS ----------
     /** Copy Constructor. */
-    Node(const T& data) : data(data), next(nullptr), previous(nullptr) {}
+    DListNode(const T& data) : data(data), next(nullptr), previous(nullptr) {}
     /** Move Constructor. */
-    Node(T&& data) : data(std::forward<T>(data)), next(nullptr), previous(nullptr) {}
-    /** Struct Destructor. */
-    ~Node()
+    DListNode(T&& data) : data(std::forward<T>(data)), next(nullptr), previous(nullptr) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    DListNode(EmplaceTag, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), previous(nullptr) {}
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    friend std::ostream& operator<<(std::ostream& output, const DListNode<T>& node)
     {
-        delete next;
-        next = nullptr;
-        previous = nullptr;
+        output << node.data;
+        for(const DListNode<T>* nextNode = node.next; nextNode != nullptr; nextNode = nextNode->next)
+            output << ", " << nextNode->data;
+        
+        return output;
     }
+};
+
+template <typename T>
+class DLinkedList;
+
+/**
+ * @class   DLinkedListIterator
+ * @brief   A bidirectional iterator over the elements of a Doubly Linked List.
+ * @details The iterator remembers the list it belongs to, so decrementing end() moves to the tail.
+ * @tparam T        Any data type or class.
+ * @tparam IsConst  True for an iterator that only gives constant access to the elements.
+ *
+ * @warning Erasing an element invalidates the iterators to it. All other iterators remain valid.
+ */
+template <typename T, bool IsConst>
+class DLinkedListIterator
+{
+public:
+    // -------------- TYPES -------------
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+    typedef typename std::conditional<IsConst, const T&, T&>::type reference;
     
-    // ----- NON-MEMEBER OPERATORS ------
-    friend std::ostream& operator<<(std::ostream& output, const Node<T>& node)
+    // ---------- CONSTRUCTORS ----------
+    /** Default Constructor. */
+    DLinkedListIterator() : node(nullptr), list(nullptr) {}
+    /** Conversion Constructor from a mutable iterator to a constant iterator. */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    DLinkedListIterator(const DLinkedListIterator<T, OtherConst>& other) : node(other.node), list(other.list) {}
+    
+    // ----------- OPERATORS ------------
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+    DLinkedListIterator& operator++()
     {
-        if(node.next)
-            return output << node.data << ", " << *node.next;
-        else
-            return output << node.data;
+        node = node->next;
+        return *this;
+    }
+    DLinkedListIterator operator++(int)
+    {
+        DLinkedListIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    DLinkedListIterator& operator--()
+    {
+        node = (node == nullptr) ? list->tail : node->previous;
+        return *this;
+    }
+    DLinkedListIterator operator--(int)
+    {
+        DLinkedListIterator temp = *this;
+        --(*this);
+        return temp;
     }
+    template <bool OtherConst>
+    bool operator==(const DLinkedListIterator<T, OtherConst>& other) const { return node == other.node; }
+    template <bool OtherConst>
+    bool operator!=(const DLinkedListIterator<T, OtherConst>& other) const { return node != other.node; }
+    
+private:
+    // ------------- FIELDS -------------
+    DListNode<T>* node;          /**< The current node, nullptr past the end of the list. */
+    const DLinkedList<T>* list;  /**< The list the iterator belongs to. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Node Constructor. */
+    DLinkedListIterator(DListNode<T>* node, const DLinkedList<T>* list) : node(node), list(list) {}
+    
+    friend class DLinkedList<T>;
+    friend class DLinkedListIterator<T, !IsConst>;
 };
 
 /**
  * @class   DLinkedList
  * @brief   A generic Doubly Linked List class.
  * @details This Doubly Linked List is templated to use any data type or class.
+ *          The list remembers the node it last reached by index, its finger, and walks to an index from
+ *          the head, the tail or the finger, whichever is closest. Sequential and nearby accesses by
+ *          index take constant time that way.
  * @tparam T    Any data type or class.
+ *
+ * @note    Only non-constant access by index moves the finger. A constant list never changes it,
+ *          so several threads can read the same constant list at once.
  */
 template <typename T>
 class DLinkedList
 {
 public:
+    // -------------- TYPES -------------
+    typedef DLinkedListIterator<T, false> iterator;
+    typedef DLinkedListIterator<T, true> const_iterator;
+    
     // ---------- CONSTRUCTORS ----------
     DLinkedList();
+    explicit DLinkedList(const std::shared_ptr<NodePool<DListNode<T>>>& sharedPool);
+    template <typename InputIterator>
+    DLinkedList(InputIterator first, InputIterator last);
+    DLinkedList(std::initializer_list<T> elements);
     DLinkedList(const DLinkedList<T>& copyList);
-    DLinkedList(DLinkedList<T>&& moveList);
+    DLinkedList(DLinkedList<T>&& moveList) noexcept;
     ~DLinkedList();
     
     // ----------- FUNCTIONS ------------
-    void addFirst(const T data);
-    void addLast(const T data);
-    void insert(const T data, const int index);
+    void addFirst(const T& data);
+    void addFirst(T&& data);
+    void addLast(const T& data);
+    void addLast(T&& data);
+    void insert(const T& data, const int index);
+    void insert(T&& data, const int index);
+    template <typename... Args>
+    void emplaceFirst(Args&&... args);
+    template <typename... Args>
+    void emplaceLast(Args&&... args);
+    template <typename... Args>
+    void emplace(const int index, Args&&... args);
     void remove(const int index);
+    iterator insertAfter(const_iterator position, const T& data);
+    iterator insertAfter(const_iterator position, T&& data);
+    template <typename... Args>
+    iterator emplaceAfter(const_iterator position, Args&&... args);
+    iterator erase(const_iterator position);
+    void splice(DLinkedList<T>& other);
+    void splice(const_iterator position, DLinkedList<T>& other, const_iterator first, const_iterator last);
+    DLinkedList<T> splitAt(const int index);
+    void merge(DLinkedList<T>& other);
+    template <typename Compare>
+    void merge(DLinkedList<T>& other, Compare compare);
+    void sort(const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Compare>
+    void sort(Compare compare, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Function>
+    void forEach(Function visit, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Function>
+    void transform(Function function, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Result, typename Combine>
+    Result reduce(Result init, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Result, typename Accumulate, typename Combine>
+    Result reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    iterator findIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Predicate>
+    const_iterator findIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    int removeIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy());
     void clear();
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last);
     T pop();
     T pop(const int index);
-    T peek();
-    T peek(const int index);
-    int size();
-    bool empty();
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    T& peek(const int index);
+    const T& peek(const int index) const;
+    int size() const;
+    bool empty() const;
+    std::shared_ptr<NodePool<DListNode<T>>> getPool();
+#if defined(DATASTRUCTURES_STATS)
+    const ContainerStats& stats();
+#endif
+    void serialize(std::ostream& output) const;
+    void deserialize(std::istream& input);
+    void serializeFlat(std::ostream& output) const;
+    void deserializeFlat(const void* data, const std::size_t bytes);
+    template <typename Sink>
+    void writeTo(Sink& sink, const char* separator = ", ") const;
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
     
     // ----------- OPERATORS ------------
     T& operator[](const int index);
     bool operator==(const DLinkedList& compareList);
     DLinkedList<T>& operator=(const DLinkedList& copyList);
-    DLinkedList<T>& operator=(DLinkedList&& moveList);
+    DLinkedList<T>& operator=(DLinkedList&& moveList) noexcept;
     
     // ----- NON-MEMEBER OPERATORS ------
     template <typename Type>
@@ -95,16 +251,27 @@ public:
     
 private:
     // ------------- FIELDS -------------
-    Node<T>* head;  /**< The head of the list. */
-    Node<T>* tail;  /**< The tail of the lsit. */
-    int listSize;   /**< The size of the list. */
+    DListNode<T>* head;               /**< The head of the list. */
+    DListNode<T>* tail;               /**< The tail of the lsit. */
+    int listSize;                     /**< The size of the list. */
+    NodeStorage<DListNode<T>> nodes;  /**< Allocates every node of the list from a shared node pool. */
+    DListNode<T>* finger;             /**< The node last reached by index, nullptr if it is not known. */
+    int fingerIndex;                  /**< The index of the finger. */
     
     // ----------- FUNCTIONS ------------
+    void copyFrom(const DLinkedList<T>& copyList);
+    int stepsTo(const int index) const;
+    DListNode<T>* nodeAt(const int index) const;
+    DListNode<T>* moveFingerTo(const int index);
+    DListNode<T>* unlinkAt(const int index);
+    void relinkPrevious();
+    void adoptNodes(DLinkedList<T>& other);
     void swap(DLinkedList<T>& other);
+    
+    friend class DLinkedListIterator<T, false>;
+    friend class DLinkedListIterator<T, true>;
 };
 
-#endif /* DLinkedList_hpp */
-
 
 // **************************************************************************
 // **************************************************************************
@@ -120,416 +287,1494 @@ private:
  *
  * @tparam T    Any data type or class.
  *
- * @details Initializes this linked list object with a nullptr head and tail and size of 0;
+ * @details Initializes this linked list object with a nullptr head and tail and size of 0;
+ */
+template <typename T>
+DLinkedList<T>::DLinkedList() : head(nullptr), tail(nullptr), listSize(0), finger(nullptr), fingerIndex(0) {}
+
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @param sharedPool    The node pool this linked list object will allocate its nodes from.
+ *
+ * @details Initializes an empty linked list object that shares its node pool with every other
+ *          list constructed from the same pool. Nodes freed by any of those lists are recycled
+ *          by all of them.
+ */
+template <typename T>
+DLinkedList<T>::DLinkedList(const std::shared_ptr<NodePool<DListNode<T>>>& sharedPool) : head(nullptr), tail(nullptr), listSize(0), nodes(sharedPool), finger(nullptr), fingerIndex(0) {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Initializes this list object with the elements of the range. See assign().
+ */
+template <typename T>
+template <typename InputIterator>
+DLinkedList<T>::DLinkedList(InputIterator first, InputIterator last) : DLinkedList()
+{
+    assign(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param elements  The elements this list object will hold.
+ *
+ * @details Initializes this list object with the elements of the list. See assign().
+ */
+template <typename T>
+DLinkedList<T>::DLinkedList(std::initializer_list<T> elements) : DLinkedList()
+{
+    assign(elements.begin(), elements.end());
+}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param copyList  The list whose contents will be copied into this linked list object.
+ *
+ * @details Every node is reserved from the node pool with a single allocation.
+ */
+template <typename T>
+DLinkedList<T>::DLinkedList(const DLinkedList<T>& copyList) : head(nullptr), tail(nullptr), listSize(0), finger(nullptr), fingerIndex(0)
+{
+    copyFrom(copyList);
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param moveList  The list whose contents will be moved into this linked list object.
+ *
+ * @details Takes over the nodes of the provided linked list in constant time,
+ *          without allocating. The provided linked list object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T>
+DLinkedList<T>::DLinkedList(DLinkedList<T>&& moveList) noexcept : head(nullptr), tail(nullptr), listSize(0), finger(nullptr), fingerIndex(0)
+{
+    moveList.swap(*this);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Clears the list using clear() function.
+ */
+template <typename T>
+DLinkedList<T>::~DLinkedList()
+{
+    clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds data to the front of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to add to the list.
+ */
+template <typename T>
+void DLinkedList<T>::addFirst(const T& data)
+{
+    emplaceFirst(data);
+}
+
+/**
+ * @brief   Moves data to the front of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ */
+template <typename T>
+void DLinkedList<T>::addFirst(T&& data)
+{
+    emplaceFirst(std::move(data));
+}
+
+/**
+ * @brief   Adds data to the end of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to add to the list.
+ */
+template <typename T>
+void DLinkedList<T>::addLast(const T& data)
+{
+    emplaceLast(data);
+}
+
+/**
+ * @brief   Moves data to the end of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ */
+template <typename T>
+void DLinkedList<T>::addLast(T&& data)
+{
+    emplaceLast(std::move(data));
+}
+
+/**
+ * @brief   Inserts data into the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to add to the list.
+ * @param index Index at which to add the data into the list.
+ */
+template <typename T>
+void DLinkedList<T>::insert(const T& data, const int index)
+{
+    emplace(index, data);
+}
+
+/**
+ * @brief   Moves data into the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ * @param index Index at which to add the data into the list.
+ */
+template <typename T>
+void DLinkedList<T>::insert(T&& data, const int index)
+{
+    emplace(index, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place at the front of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the data.
+ */
+template <typename T>
+template <typename... Args>
+void DLinkedList<T>::emplaceFirst(Args&&... args)
+{
+    DListNode<T>* node_newHead = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    if(head == nullptr)
+        tail = node_newHead;
+    else
+    {
+        head->previous = node_newHead;
+        node_newHead->next = head;
+    }
+    
+    if(finger != nullptr)   // Every element moved one index back.
+        fingerIndex++;
+    head = node_newHead;
+    listSize++;
+}
+
+/**
+ * @brief   Constructs data in place at the end of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the data.
+ */
+template <typename T>
+template <typename... Args>
+void DLinkedList<T>::emplaceLast(Args&&... args)
+{
+    DListNode<T>* node_newTail = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    if(head == nullptr)
+        head = node_newTail;
+    else
+    {
+        tail->next = node_newTail;
+        node_newTail->previous = tail;
+    }
+    
+    tail = node_newTail;
+    listSize++;
+}
+
+/**
+ * @brief   Constructs data in place at the specified index of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param index Index at which to add the data into the list.
+ * @param args  The arguments forwarded to the constructor of the data.
+ *
+ * @details Walks to the index from the head, the tail or the finger, whichever is closest,
+ *          and leaves the finger on the new node.
+ */
+template <typename T>
+template <typename... Args>
+void DLinkedList<T>::emplace(const int index, Args&&... args)
+{
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::INSERT);
+    if(index > 0 && index < listSize)
+        nodes.getStats().recordTraversal(ContainerStats::INSERT, stepsTo(index));
+#endif
+    if(index <= 0)
+    {
+        emplaceFirst(std::forward<Args>(args)...);
+        return;
+    }
+    else if(index >= listSize)
+    {
+        emplaceLast(std::forward<Args>(args)...);
+        return;
+    }
+    
+    DListNode<T>* node = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    DListNode<T>* temp = moveFingerTo(index);
+    
+    node->next = temp;
+    node->previous = temp->previous;
+    temp->previous->next = node;
+    temp->previous = node;
+    finger = node;
+    listSize++;
+}
+
+/**
+ * @brief   Removes data from the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index at which to remove data from the list.
+ *
+ * @details Walks to the index from the head, the tail or the finger, whichever is closest,
+ *          and leaves the finger on the element that took the place of the removed one.
+ */
+template <typename T>
+void DLinkedList<T>::remove(const int index)
+{
+    // Do nothing if list is empty or index out of range.
+    if(listSize == 0 || index < 0 || index >= listSize)
+        return;
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::REMOVE);
+    nodes.getStats().recordTraversal(ContainerStats::REMOVE, stepsTo(index));
+#endif
+
+    nodes.destroy(unlinkAt(index));
+}
+
+/**
+ * @brief   Inserts data into the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to add to the list.
+ * @return          An iterator to the added data.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename DLinkedList<T>::iterator DLinkedList<T>::insertAfter(const_iterator position, const T& data)
+{
+    return emplaceAfter(position, data);
+}
+
+/**
+ * @brief   Moves data into the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to move into the list.
+ * @return          An iterator to the added data.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename DLinkedList<T>::iterator DLinkedList<T>::insertAfter(const_iterator position, T&& data)
+{
+    return emplaceAfter(position, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Args     The types of the constructor arguments.
+ * @param position  Iterator to the element after which to add the data.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          An iterator to the added data.
+ *
+ * @details Links the new node in constant time, without walking the list.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+template <typename... Args>
+typename DLinkedList<T>::iterator DLinkedList<T>::emplaceAfter(const_iterator position, Args&&... args)
+{
+    DListNode<T>* node = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    node->previous = position.node;
+    node->next = position.node->next;
+    position.node->next = node;
+    
+    if(node->next == nullptr)
+        tail = node;
+    else
+        node->next->previous = node;
+    
+    finger = nullptr;   // The index of the finger is not known anymore.
+    listSize++;
+    return iterator(node, this);
+}
+
+/**
+ * @brief   Removes the data at the specified position from the list.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element to remove.
+ * @return          An iterator to the element that followed the removed one.
+ *
+ * @details Unlinks the node in constant time, without walking the list.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename DLinkedList<T>::iterator DLinkedList<T>::erase(const_iterator position)
+{
+    DListNode<T>* deleteNode = position.node;
+    DListNode<T>* nextNode = deleteNode->next;
+    
+    if(deleteNode->previous == nullptr) // Removing the head of list.
+        head = nextNode;
+    else
+        deleteNode->previous->next = nextNode;
+    
+    if(nextNode == nullptr)             // Removing the tail of list.
+        tail = deleteNode->previous;
+    else
+        nextNode->previous = deleteNode->previous;
+    
+    finger = nullptr;   // The index of the finger is not known anymore.
+    nodes.destroy(deleteNode);
+    listSize--;
+    return iterator(nextNode, this);
+}
+
+/**
+ * @brief   Moves every element of another list to the end of this list.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The list whose elements will be moved. It is empty afterwards.
+ *
+ * @details The nodes of the other list are relinked in constant time, nothing is copied or allocated.
+ *          Both lists share one node pool afterwards.
+ *
+ * @note    If both lists already share their node pools with further lists, the nodes of the other
+ *          list have to be recreated in the node pool of this list first.
+ */
+template <typename T>
+void DLinkedList<T>::splice(DLinkedList<T>& other)
+{
+    if(this == &other || other.head == nullptr)
+        return;
+    
+    adoptNodes(other);
+    
+    if(head == nullptr)
+        head = other.head;
+    else
+    {
+        tail->next = other.head;
+        other.head->previous = tail;
+    }
+    
+    tail = other.tail;
+    listSize += other.listSize;
+    
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.listSize = 0;
+    other.finger = nullptr;
+}
+
+/**
+ * @brief   Moves a range of elements from another list into this list, right before the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element of this list before which the range is inserted. May be end().
+ * @param other     The list that holds the range. May be this list.
+ * @param first     Iterator to the first element of the range.
+ * @param last      Iterator past the last element of the range.
+ *
+ * @details The nodes of the range are relinked without being copied or allocated, which takes
+ *          time proportional to the length of the range to keep track of both list sizes.
+ *          Both lists share one node pool afterwards.
+ *
+ * @note    If both lists already share their node pools with further lists, the elements of the
+ *          range are moved into new nodes from the node pool of this list instead.
+ *
+ * @warning The position must not be inside the range.
+ */
+template <typename T>
+void DLinkedList<T>::splice(const_iterator position, DLinkedList<T>& other, const_iterator first, const_iterator last)
+{
+    if(first == last || (this == &other && position == last))
+        return;
+    
+    if(this != &other && !nodes.share(other.nodes))
+    {
+        // Move the range into a list of new nodes from this pool, then splice those nodes instead.
+        DLinkedList<T> temp(nodes.getPool());
+        for(iterator it(first.node, &other); it != last; it = other.erase(it))
+            temp.emplaceLast(std::move(*it));
+        
+        splice(position, temp, temp.cbegin(), temp.cend());
+        return;
+    }
+    
+    DListNode<T>* rangeFirst = first.node;
+    DListNode<T>* rangeLast = (last.node == nullptr) ? other.tail : last.node->previous;
+    finger = nullptr;   // The indices of the fingers are not known anymore.
+    other.finger = nullptr;
+    
+    if(this != &other)
+    {
+        int rangeSize = 1;
+        for(DListNode<T>* node = rangeFirst; node != rangeLast; node = node->next)
+            rangeSize++;
+        
+        other.listSize -= rangeSize;
+        listSize += rangeSize;
+    }
+    
+    // Unlink the range from the other list.
+    if(rangeFirst->previous == nullptr)
+        other.head = last.node;
+    else
+        rangeFirst->previous->next = last.node;
+    
+    if(last.node == nullptr)
+        other.tail = rangeFirst->previous;
+    else
+        last.node->previous = rangeFirst->previous;
+    
+    // Link the range in before the position.
+    DListNode<T>* after = position.node;
+    DListNode<T>* before = (after == nullptr) ? tail : after->previous;
+    rangeFirst->previous = before;
+    rangeLast->next = after;
+    
+    if(before == nullptr)
+        head = rangeFirst;
+    else
+        before->next = rangeFirst;
+    
+    if(after == nullptr)
+        tail = rangeLast;
+    else
+        after->previous = rangeLast;
+}
+
+/**
+ * @brief   Splits the list in two at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index of the first element that is moved into the returned list.
+ * @return      A list with the elements from the index to the end of this list.
+ *
+ * @details This list keeps the elements before the index. The nodes are relinked, not copied,
+ *          and the returned list shares the node pool of this list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the index is out of range when function is called.
+ *          The index may be equal to the size of the list, in which case the returned list is empty.
+ */
+template <typename T>
+DLinkedList<T> DLinkedList<T>::splitAt(const int index)
+{
+    if(index < 0 || index > listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    DLinkedList<T> splitList(nodes.getPool());
+    if(index == listSize)
+        return splitList;
+    
+    splitList.tail = tail;
+    splitList.listSize = listSize - index;
+    if(fingerIndex >= index)    // The finger moves into the returned list.
+        finger = nullptr;
+    
+    if(index == 0)
+    {
+        splitList.head = head;
+        head = nullptr;
+        tail = nullptr;
+    }
+    else
+    {
+        DListNode<T>* newTail = nodeAt(index-1);
+        splitList.head = newTail->next;
+        splitList.head->previous = nullptr;
+        newTail->next = nullptr;
+        tail = newTail;
+    }
+    
+    listSize = index;
+    return splitList;
+}
+
+/**
+ * @brief   Merges another sorted list into this sorted list.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The sorted list whose elements will be merged. It is empty afterwards.
+ *
+ * @details Both lists must be sorted in ascending order using operator<. The merge is stable,
+ *          equal elements of this list stay in front of the ones from the other list.
+ *          The nodes are relinked, nothing is copied or allocated.
+ *
+ * @note    If both lists already share their node pools with further lists, the nodes of the other
+ *          list have to be recreated in the node pool of this list first.
+ */
+template <typename T>
+void DLinkedList<T>::merge(DLinkedList<T>& other)
+{
+    merge(other, std::less<T>());
+}
+
+/**
+ * @brief   Merges another sorted list into this sorted list using a custom comparison.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param other     The sorted list whose elements will be merged. It is empty afterwards.
+ * @param compare   The comparison both lists are sorted by.
+ *
+ * @details The merge is stable, equal elements of this list stay in front of the ones from the
+ *          other list. The nodes are relinked, nothing is copied or allocated.
+ */
+template <typename T>
+template <typename Compare>
+void DLinkedList<T>::merge(DLinkedList<T>& other, Compare compare)
+{
+    if(this == &other || other.head == nullptr)
+        return;
+    
+    adoptNodes(other);
+    
+    DListNode<T>* current = head;
+    DListNode<T>* otherCurrent = other.head;
+    DListNode<T>* mergedTail = nullptr;  // The last node of the merged part.
+    DListNode<T>** link = &head;         // The next pointer that receives the next merged node.
+    while(current != nullptr && otherCurrent != nullptr)
+    {
+        if(compare(otherCurrent->data, current->data))
+        {
+            *link = otherCurrent;
+            otherCurrent = otherCurrent->next;
+        }
+        else
+        {
+            *link = current;
+            current = current->next;
+        }
+        (*link)->previous = mergedTail;
+        mergedTail = *link;
+        link = &mergedTail->next;
+    }
+    
+    if(current == nullptr)          // The rest of the other list ends the merged list.
+    {
+        *link = otherCurrent;
+        tail = other.tail;
+    }
+    else
+        *link = current;
+    (*link)->previous = mergedTail;
+    
+    listSize += other.listSize;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.listSize = 0;
+    finger = nullptr;   // The indices of the fingers are not known anymore.
+    other.finger = nullptr;
+}
+
+/**
+ * @brief   Sorts the list in ascending order using operator<.
+ *
+ * @tparam T        Any data type or class.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details See sort(Compare, const ExecutionPolicy&).
+ */
+template <typename T>
+void DLinkedList<T>::sort(const ExecutionPolicy& policy)
+{
+    sort(std::less<T>(), policy);
+}
+
+/**
+ * @brief   Sorts the list using a custom comparison.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param compare   The comparison to sort by.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details A stable merge sort that relinks the nodes in O(n log n) time, nothing is copied or allocated.
+ *          A parallel policy sorts one segment of the list per thread and merges the sorted segments.
+ *          See sortChain().
+ *
+ * @note    If the comparison throws, every element is still in the list, in an unspecified order.
+ */
+template <typename T>
+template <typename Compare>
+void DLinkedList<T>::sort(Compare compare, const ExecutionPolicy& policy)
+{
+    finger = nullptr;
+    try
+    {
+        sortChain(head, listSize, compare, policy);
+    }
+    catch(...)
+    {
+        relinkPrevious();
+        throw;
+    }
+    relinkPrevious();
+}
+
+/**
+ * @brief   Calls a function on every element of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a reference to an element.
+ * @param visit     The function.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details Visits the elements from head to tail. A parallel policy visits one segment of the list
+ *          per thread instead, each with its own copy of the function.
+ */
+template <typename T>
+template <typename Function>
+void DLinkedList<T>::forEach(Function visit, const ExecutionPolicy& policy)
+{
+    forEachInChain(head, listSize, visit, policy);
+}
+
+/**
+ * @brief   Replaces every element of the list with the result of a function.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes an element and returns its replacement.
+ * @param function  The function.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details Works like forEach(), assigning the result of the function to every element.
+ */
+template <typename T>
+template <typename Function>
+void DLinkedList<T>::transform(Function function, const ExecutionPolicy& policy)
+{
+    forEachInChain(head, listSize, [function](T& data) mutable { data = function(data); }, policy);
+}
+
+/**
+ * @brief   Combines every element of the list into one result.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Result   The type of the result.
+ * @tparam Combine  A callable that combines any mix of a Result and an element into a Result.
+ * @param init      The value the result starts from.
+ * @param combine   The combination.
+ * @param policy    The execution policy, sequential by default.
+ * @return          The combination of init and every element.
+ *
+ * @details Combines the elements from head to tail. A parallel policy combines one segment of the
+ *          list per thread and then the segment results, so the combination must be associative
+ *          and commutative, like for std::reduce(). See reduceChain().
+ */
+template <typename T>
+template <typename Result, typename Combine>
+Result DLinkedList<T>::reduce(Result init, Combine combine, const ExecutionPolicy& policy) const
+{
+    return reduceChain(head, listSize, std::move(init), combine, policy);
+}
+
+/**
+ * @brief   Combines every element of the list into a result of another type.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Result       The type of the result.
+ * @tparam Accumulate   A callable that adds an element to a Result and returns the new Result.
+ * @tparam Combine      A callable that combines two Results into one.
+ * @param identity      The value the result starts from, which combine() must leave unchanged, like 0 for a sum.
+ * @param accumulate    The accumulation.
+ * @param combine       The combination of two results.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The accumulation of every element onto identity.
+ *
+ * @details Accumulates the elements from head to tail. A parallel policy accumulates one segment of
+ *          the list per thread, each starting from identity, and combines the segment results in
+ *          order, so the combination must be associative. See reduceChain().
+ */
+template <typename T>
+template <typename Result, typename Accumulate, typename Combine>
+Result DLinkedList<T>::reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy) const
+{
+    return reduceChain(head, listSize, std::move(identity), accumulate, combine, policy);
+}
+
+/**
+ * @brief   Returns an iterator to the first element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it matches.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              An iterator to the first matching element, or end() if none matches.
+ *
+ * @details A parallel policy searches one segment of the list per thread. Every thread stops at its
+ *          first match or as soon as an earlier segment found one, and the earliest match is returned.
+ */
+template <typename T>
+template <typename Predicate>
+typename DLinkedList<T>::iterator DLinkedList<T>::findIf(Predicate predicate, const ExecutionPolicy& policy)
+{
+    return iterator(findInChain(head, listSize, predicate, policy), this);
+}
+
+/**
+ * @brief   Returns a constant iterator to the first element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it matches.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              A constant iterator to the first matching element, or end() if none matches.
+ *
+ * @details See findIf(Predicate, const ExecutionPolicy&).
+ */
+template <typename T>
+template <typename Predicate>
+typename DLinkedList<T>::const_iterator DLinkedList<T>::findIf(Predicate predicate, const ExecutionPolicy& policy) const
+{
+    return const_iterator(findInChain(head, listSize, predicate, policy), this);
+}
+
+/**
+ * @brief   Removes every element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it should be removed.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The number of removed elements.
+ *
+ * @details Tests and unlinks the elements in one pass from head to tail. A parallel policy tests one
+ *          segment of the list per thread first, and then unlinks the matching elements on the
+ *          calling thread, because the node pool is not thread safe.
+ */
+template <typename T>
+template <typename Predicate>
+int DLinkedList<T>::removeIf(Predicate predicate, const ExecutionPolicy& policy)
+{
+    bool parallel = (policy.segmentsFor(listSize) > 1);
+    std::vector<char> matches;
+    if(parallel)
+        matches = matchChain(head, listSize, predicate, policy);
+    
+    finger = nullptr;
+    int removed = 0;
+    DListNode<T>** link = &head;    // The next pointer that points at the node being tested.
+    for(int index = 0; *link != nullptr; index++)
+    {
+        DListNode<T>* node = *link;
+        if(parallel ? !matches[index] : !predicate(node->data))
+        {
+            link = &node->next;
+            continue;
+        }
+        
+        *link = node->next;
+        if(node->next == nullptr)   // Removing the tail of list.
+            tail = node->previous;
+        else
+            node->next->previous = node->previous;
+        
+        nodes.destroy(node);
+        listSize--;
+        removed++;
+    }
+    
+    return removed;
+}
+
+/**
+ * @brief   Clears the entire list and resets all field elements to default.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Walks the list iteratively, so it never needs more than constant stack space.
+ *          If this list is the only user of its node pool, the whole pool is released slab by slab
+ *          instead of node by node, and the walk is skipped entirely when the data is trivially
+ *          destructible. Otherwise every node is given back to the shared pool for reuse.
+ */
+template <typename T>
+void DLinkedList<T>::clear()
+{
+    nodes.destroyChain(head, &DListNode<T>::next);
+    
+    head = nullptr;
+    tail = nullptr;
+    listSize = 0;
+    finger = nullptr;
+}
+
+/**
+ * @brief   Replaces the contents of the list with the elements of a range.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Builds the list in one pass over the range. When the size of the range
+ *          can be counted up front, every node is reserved from the node pool with a single allocation.
+ *
+ * @warning The range must not point into this list.
+ */
+template <typename T>
+template <typename InputIterator>
+void DLinkedList<T>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    
+    int count = rangeSize(first, last);
+    nodes.reserve(count);
+    
+    for(; first != last; ++first)
+        emplaceLast(*first);
+}
+
+/**
+ * @brief   Removes and returns the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The removed data.
+ *
+ * @details The data is moved out of the removed node, not copied.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T>
+T DLinkedList<T>::pop()
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    DListNode<T>* deleteNode = unlinkAt(0);
+    T popped_data = std::move(deleteNode->data);
+    nodes.destroy(deleteNode);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes and returns data from the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index at which to retrieve and remove data from the list.
+ * @return      The removed data.
+ *
+ * @details The data is moved out of the removed node, not copied. Walks to the index from the head,
+ *          the tail or the finger, whichever is closest.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T>
+T DLinkedList<T>::pop(const int index)
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    DListNode<T>* deleteNode = unlinkAt(index);
+    T popped_data = std::move(deleteNode->data);
+    nodes.destroy(deleteNode);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes the head of the list and moves it into the provided variable.
+ *
+ * @tparam T    Any data type or class.
+ * @param out   The variable that receives the removed data.
+ * @return      True if data was removed, false if the list is empty.
+ *
+ * @details Works like pop() but reports an empty list through the return value instead of throwing.
+ */
+template <typename T>
+bool DLinkedList<T>::tryPop(T& out)
+{
+    if(head == nullptr)
+        return false;
+    
+    out = std::move(head->data);
+    remove(0);
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T>
+T& DLinkedList<T>::peek()
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return head->data;
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T>
+const T& DLinkedList<T>::peek() const
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return head->data;
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index at which to retrieve data from the list.
+ * @return      A reference to the data located at the specified index of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T>
+T& DLinkedList<T>::peek(const int index)
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    return moveFingerTo(index)->data;
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index at which to retrieve data from the list.
+ * @return      A constant reference to the data located at the specified index of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T>
+const T& DLinkedList<T>::peek(const int index) const
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    return nodeAt(index)->data;
+}
+
+/**
+ * @brief   Returns the size of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The size of the list.
+ */
+template <typename T>
+int DLinkedList<T>::size() const
+{
+    return listSize;
+}
+
+/**
+ * @brief   Returns true if the list is empty and false otherwise.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A boolean flag.
+ */
+template <typename T>
+bool DLinkedList<T>::empty() const
+{
+    return listSize == 0;
+}
+
+/**
+ * @brief   Returns the node pool used by this list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The shared node pool.
+ *
+ * @details The returned pool can be passed to the Shared Pool Constructor of another list
+ *          so both lists allocate from, and recycle into, the same pool.
+ */
+template <typename T>
+std::shared_ptr<NodePool<DListNode<T>>> DLinkedList<T>::getPool()
+{
+    return nodes.getPool();
+}
+
+#if defined(DATASTRUCTURES_STATS)
+/**
+ * @brief   Returns the statistics of this list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The statistics, with the bytes held brought up to date.
+ *
+ * @details Counts the nodes allocated and freed and the bytes held by the nodes. For operator[],
+ *          insert() and remove() it also counts the calls, the nodes stepped over to reach the
+ *          index from the head, the tail or the finger, whichever is closest, and the latencies.
+ *
+ * @note    Only available when DATASTRUCTURES_STATS is defined.
+ */
+template <typename T>
+const ContainerStats& DLinkedList<T>::stats()
+{
+    ContainerStats& listStats = nodes.getStats();
+    listStats.recordBytesHeld((long long)listSize * sizeof(DListNode<T>));
+    return listStats;
+}
+#endif
+
+/**
+ * @brief   Writes the list to a stream in the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then every element from head to tail with ElementCodec<T>,
+ *          iteratively, so a list of any length can be written. Read it back with deserialize().
+ */
+template <typename T>
+void DLinkedList<T>::serialize(std::ostream& output) const
+{
+    writeSerialHeader(output, SERIAL_MAGIC, SERIAL_DOUBLY_LINKED_LIST, 0, ElementCodec<T>::SIZE, (std::uint64_t)listSize);
+    for(const DListNode<T>* node = head; node != nullptr; node = node->next)
+        ElementCodec<T>::write(output, node->data);
+}
+
+/**
+ * @brief   Replaces the contents of the list with a list read from the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param input     The input stream, opened in binary mode, at data written by serialize().
+ *
+ * @details The elements are read into a new list that allocates from the node pool of this list,
+ *          which then takes the place of this list. If anything goes wrong, this list is unchanged.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serialize() of a Doubly Linked List
+ *          with the same element type, or if the input ends early.
+ */
+template <typename T>
+void DLinkedList<T>::deserialize(std::istream& input)
+{
+    SerialHeader header = readSerialHeader(input, SERIAL_DOUBLY_LINKED_LIST, ElementCodec<T>::SIZE);
+    DLinkedList<T> temp(nodes.getPool());
+    for(std::uint64_t i = 0; i < header.count; i++)
+        temp.emplaceLast(ElementCodec<T>::read(input));
+    
+    swap(temp);
+}
+
+/**
+ * @brief   Writes the list to a stream in the flat binary format.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then the raw elements from head to tail, aligned for T, so the
+ *          written file can be memory mapped and used in place through a FlatView, or loaded again
+ *          with deserializeFlat().
  */
 template <typename T>
-DLinkedList<T>::DLinkedList() : head(nullptr), tail(nullptr), listSize(0) {}
+void DLinkedList<T>::serializeFlat(std::ostream& output) const
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The flat format needs a trivially copyable element type");
+    
+    writeSerialHeader(output, FLAT_MAGIC, SERIAL_DOUBLY_LINKED_LIST, 0, sizeof(T), (std::uint64_t)listSize, alignof(T));
+    for(const DListNode<T>* node = head; node != nullptr; node = node->next)
+        output.write(reinterpret_cast<const char*>(&node->data), sizeof(T));
+}
 
 /**
- * @brief   Copy Constructor.
+ * @brief   Replaces the contents of the list with the elements of data in the flat binary format.
  *
- * @tparam T        Any data type or class.
- * @param copyList  The list whose contents will be copied into this linked list object.
+ * @tparam T        A trivially copyable type.
+ * @param data      The start of data written by serializeFlat(), for example a memory mapped file.
+ * @param bytes     The size of the data.
+ *
+ * @details Nothing is parsed, the elements are copied straight out of the data with assign(),
+ *          which reserves every node with a single allocation.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serializeFlat() of a Doubly Linked List
+ *          with the same element type, or if it is truncated or misaligned. This list is unchanged then.
  */
 template <typename T>
-DLinkedList<T>::DLinkedList(const DLinkedList<T>& copyList) : head(nullptr), tail(nullptr), listSize(0)
+void DLinkedList<T>::deserializeFlat(const void* data, const std::size_t bytes)
 {
-    Node<T>** currentNode = &head;
-    Node<T>* previousNode = nullptr;
-    for(Node<T>* copyNode = copyList.head; copyNode; copyNode = copyNode->next)
-    {
-        (*currentNode) = new Node<T>(copyNode->data);
-        
-        (*currentNode)->previous = previousNode;
-        previousNode = *currentNode;
-        
-        currentNode = &(*currentNode)->next;
-        listSize++;
-    }
-    
-    tail = previousNode;
+    FlatView<T> view(data, bytes, SERIAL_DOUBLY_LINKED_LIST);
+    assign(view.begin(), view.end());
 }
 
 /**
- * @brief   Move Constructor.
+ * @brief   Writes every element of the list to a sink, from head to tail.
  *
  * @tparam T        Any data type or class.
- * @param moveList  The list whose contents will be moved into this linked list object.
+ * @tparam Sink     Any type with a write(const char* data, std::size_t size) function, like std::ostream,
+ *                  StringSink, BufferSink or FileDescriptorSink.
+ * @param sink      The sink the elements are written to.
+ * @param separator The text written between two elements.
  *
- * @note std::move() needs to be used to call this constructor.
+ * @details Walks the list iteratively and formats the elements through a BufferedWriter, so a list of
+ *          any length is written with constant stack space and a single chunk of memory. When the sink
+ *          is a stream, the elements are formatted with the formatting of the stream.
  */
 template <typename T>
-DLinkedList<T>::DLinkedList(DLinkedList<T>&& moveList) : head(nullptr), tail(nullptr), listSize(0)
+template <typename Sink>
+void DLinkedList<T>::writeTo(Sink& sink, const char* separator) const
 {
-    Node<T>** currentNode = &head;
-    Node<T>* previousNode = nullptr;
-    for(Node<T>* moveNode = moveList.head; moveNode; moveNode = moveNode->next)
+    BufferedWriter<Sink> writer(sink, formatOf(sink));
+    for(const DListNode<T>* node = head; node != nullptr; node = node->next)
     {
-        (*currentNode) = new Node<T>(std::move(moveNode->data));
-        
-        (*currentNode)->previous = previousNode;
-        previousNode = *currentNode;
-        
-        currentNode = &(*currentNode)->next;
-        listSize++;
+        if(node != head)
+            writer.write(separator);
+        writer.writeElement(node->data);
     }
     
-    tail = previousNode;
-    moveList.clear();
+    writer.flush();
 }
 
 /**
- * @brief   Class Destructor.
+ * @brief   Returns an iterator to the head of the list.
  *
  * @tparam T    Any data type or class.
- *
- * @details Recursively clears the list using clear() function.
+ * @return      An iterator to the first element, or end() if the list is empty.
  */
 template <typename T>
-DLinkedList<T>::~DLinkedList()
+typename DLinkedList<T>::iterator DLinkedList<T>::begin()
 {
-    clear();
+    return iterator(head, this);
 }
 
-
-// ------------------------------------------------------
-// --------------------- FUNCTIONS ----------------------
-// ------------------------------------------------------
 /**
- * @brief   Adds data to the front of the list.
+ * @brief   Returns a constant iterator to the head of the list.
  *
  * @tparam T    Any data type or class.
- * @param data  The data you want to add to the list.
+ * @return      A constant iterator to the first element, or end() if the list is empty.
  */
 template <typename T>
-void DLinkedList<T>::addFirst(const T data)
+typename DLinkedList<T>::const_iterator DLinkedList<T>::begin() const
 {
-    Node<T>* node_newHead = new Node<T>(data);
-    if(head == nullptr)
-        tail = node_newHead;
-    else
-    {
-        head->previous = node_newHead;
-        node_newHead->next = head;
-    }
-    
-    head = node_newHead;
-    listSize++;
+    return const_iterator(head, this);
 }
 
 /**
- * @brief   Adds data to the end of the list.
+ * @brief   Returns a constant iterator to the head of the list.
  *
  * @tparam T    Any data type or class.
- * @param data  The data you want to add to the list.
+ * @return      A constant iterator to the first element, or cend() if the list is empty.
  */
 template <typename T>
-void DLinkedList<T>::addLast(const T data)
+typename DLinkedList<T>::const_iterator DLinkedList<T>::cbegin() const
 {
-    Node<T>* node_newTail = new Node<T>(data);
-    if(head == nullptr)
-        head = node_newTail;
-    else
-    {
-        tail->next = node_newTail;
-        node_newTail->previous = tail;
-    }
-    
-    tail = node_newTail;
-    listSize++;
+    return begin();
 }
 
 /**
- * @brief   Inserts data into the list at the specified index.
+ * @brief   Returns an iterator past the tail of the list.
  *
  * @tparam T    Any data type or class.
- * @param data  The data you want to add to the list.
- * @param index Index at which to add the data into the list.
+ * @return      An iterator past the last element.
  */
 template <typename T>
-void DLinkedList<T>::insert(const T data, const int index)
+typename DLinkedList<T>::iterator DLinkedList<T>::end()
 {
-    if(index <= 0)
-    {
-        addFirst(data);
-        return;
-    }
-    else if(index >= listSize)
-    {
-        addLast(data);
-        return;
-    }
-    
-    Node<T>* node = new Node<T>(data);
-    Node<T>* temp;
-    if(index < listSize/2)
-    {
-        temp = head;
-        for(int i = 0; i < index; i++)
-            temp = temp->next;
-    }
-    else
-    {
-        temp = tail;
-        for(int i = listSize-1; i > index; i--)
-            temp = temp->previous;
-    }
-    
-    node->next = temp;
-    node->previous = temp->previous;
-    temp->previous->next = node;
-    temp->previous = node;
-    listSize++;
+    return iterator(nullptr, this);
 }
 
 /**
- * @brief   Removes data from the list at the specified index.
+ * @brief   Returns a constant iterator past the tail of the list.
  *
  * @tparam T    Any data type or class.
- * @param index Index at which to remove data from the list.
+ * @return      A constant iterator past the last element.
  */
 template <typename T>
-void DLinkedList<T>::remove(const int index)
+typename DLinkedList<T>::const_iterator DLinkedList<T>::end() const
 {
-    // Do nothing if list is empty or index out of range.
-    if(listSize == 0 || index < 0 || index >= listSize)
-        return;
-    
-    Node<T>* deleteNode = head;
-    
-    if(index == 0)  // Remove the head of list.
-    {
-        deleteNode = head;
-        head = head->next;
-        if(head == nullptr) // If list is empty, make sure tail is set to nullptr.
-            tail = nullptr;
-        else
-            head->previous = nullptr;
-    }
-    else if(index == listSize-1)    // Removing the tail of list.
-    {
-        deleteNode = tail;
-        tail = tail->previous;
-        if(tail == nullptr) // If list is empty, make sure head is set to nullptr.
-            head = nullptr;
-        else
-            tail->next = nullptr;
-    }
-    else if(index < listSize/2)
-    {
-        deleteNode = head->next;        // Start with element after head.
-        for(int i = 1; i < index; i++)
-            deleteNode = deleteNode->next;
-        
-        deleteNode->previous->next = deleteNode->next;
-        deleteNode->next->previous = deleteNode->previous;
-    }
-    else
-    {
-        deleteNode = tail->previous;    // Start with element before tail.
-        for(int i = listSize-2; i > index; i--)
-            deleteNode = deleteNode->previous;
-        
-        deleteNode->previous->next = deleteNode->next;
-        deleteNode->next->previous = deleteNode->previous;
-    }
-    
-    deleteNode->next = nullptr;
-    deleteNode->previous = nullptr;
-    delete deleteNode;
-    listSize--;
+    return const_iterator(nullptr, this);
 }
 
 /**
- * @brief   Clears the entire list recursively and resets all field elements to default.
+ * @brief   Returns a constant iterator past the tail of the list.
  *
  * @tparam T    Any data type or class.
+ * @return      A constant iterator past the last element.
  */
 template <typename T>
-void DLinkedList<T>::clear()
+typename DLinkedList<T>::const_iterator DLinkedList<T>::cend() const
 {
-    delete head;
-    head = nullptr;
-    tail = nullptr;
-    listSize = 0;
+    return end();
 }
 
 /**
- * @brief   Removes and returns the head of the list.
+ * @brief   Copies the elements of another list into this list.
  *
- * @tparam T    Any data type or class.
- * @return      The removed data.
+ * @tparam T        Any data type or class.
+ * @param copyList  The list whose elements will be copied into this list object.
  *
- * @throw   std::out_of_range
- * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ * @details The nodes this list already has are reused in place. Extra nodes are destroyed,
+ *          and the missing nodes are reserved from the node pool with a single allocation.
  */
 template <typename T>
-T DLinkedList<T>::pop()
+void DLinkedList<T>::copyFrom(const DLinkedList<T>& copyList)
 {
-    if(head == nullptr)
-        throw std::out_of_range("Linked List is Empty");
-    
-    Node<T>* deleteNode = head;
-    T popped_data = head->data;
-    head = head->next;
-    if(head == nullptr) // If list is empty, make sure tail is set to nullptr.
-        tail = nullptr;
-    else
-        head->previous = nullptr;
+    finger = nullptr;
+    DListNode<T>** currentNode = &head;
+    DListNode<T>* lastNode = nullptr;
+    const DListNode<T>* copyNode = copyList.head;
+    int copied = 0;
+    for(; *currentNode != nullptr && copyNode != nullptr; copyNode = copyNode->next)
+    {
+        (*currentNode)->data = copyNode->data;
+        lastNode = *currentNode;
+        currentNode = &(*currentNode)->next;
+        copied++;
+    }
     
-    deleteNode->next = nullptr;
-    deleteNode->previous = nullptr;
-    delete deleteNode;
-    listSize--;
+    // This list was longer, destroy the nodes past the copied ones.
+    DListNode<T>* extraNode = *currentNode;
+    *currentNode = nullptr;
+    while(extraNode != nullptr)
+    {
+        DListNode<T>* nextNode = extraNode->next;
+        nodes.destroy(extraNode);
+        extraNode = nextNode;
+    }
+    tail = lastNode;
+    listSize = copied;
     
-    return popped_data;
+    // This list was shorter, append the rest.
+    nodes.reserve(copyList.listSize - copied);
+    for(; copyNode != nullptr; copyNode = copyNode->next)
+    {
+        (*currentNode) = nodes.create(copyNode->data);
+        (*currentNode)->previous = tail;
+        tail = *currentNode;
+        currentNode = &(*currentNode)->next;
+        listSize++;
+    }
 }
 
 /**
- * @brief   Removes and returns data from the list at the specified index.
+ * @brief   Returns the number of nodes nodeAt() steps over to reach the specified index.
  *
  * @tparam T    Any data type or class.
- * @param index Index at which to retrieve and remove data from the list.
- * @return      The removed data.
- *
- * @throw   std::out_of_range
- * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ * @param index Index of the node. Must be within range of the list.
+ * @return      The distance of the index from the head, the tail or the finger, whichever is closest.
  */
 template <typename T>
-T DLinkedList<T>::pop(const int index)
+int DLinkedList<T>::stepsTo(const int index) const
 {
-    if(head == nullptr)
-        throw std::out_of_range("Linked List is Empty");
-    else if(index < 0 || index >= listSize)
-        throw std::out_of_range("Index is out of range.");
-    
-    Node<T>* deleteNode = head;
-    
-    if(index == 0)  // Pop the head of list.
+    int steps = (index < listSize/2) ? index : listSize-1-index;
+    if(finger != nullptr)
     {
-        deleteNode = head;
-        head = head->next;
-        if(head == nullptr) // If list is empty, make sure tail is set to nullptr.
-            tail = nullptr;
-        else
-            head->previous = nullptr;
+        int fingerSteps = (index < fingerIndex) ? fingerIndex-index : index-fingerIndex;
+        if(fingerSteps < steps)
+            steps = fingerSteps;
     }
-    else if(index == listSize-1)    // Pop the tail of list.
+    
+    return steps;
+}
+
+/**
+ * @brief   Returns the node located at the specified index of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index of the node. Must be within range of the list.
+ * @return      The node located at the specified index.
+ *
+ * @details Walks from the head, the tail or the finger, whichever is closest to the index.
+ *          The finger is not moved, see moveFingerTo().
+ */
+template <typename T>
+DListNode<T>* DLinkedList<T>::nodeAt(const int index) const
+{
+    DListNode<T>* temp;
+    if(finger != nullptr && stepsTo(index) < ((index < listSize/2) ? index : listSize-1-index))
     {
-        deleteNode = tail;
-        tail = tail->previous;
-        if(tail == nullptr) // If list is empty, make sure head is set to nullptr.
-            head = nullptr;
-        else
-            tail->next = nullptr;
+        temp = finger;
+        for(int i = fingerIndex; i < index; i++)
+            temp = temp->next;
+        for(int i = fingerIndex; i > index; i--)
+            temp = temp->previous;
     }
     else if(index < listSize/2)
     {
-        deleteNode = head->next;        // Start with element after head.
-        for(int i = 1; i < index; i++)
-            deleteNode = deleteNode->next;
-        
-        deleteNode->previous->next = deleteNode->next;
-        deleteNode->next->previous = deleteNode->previous;
+        temp = head;
+        for(int i = 0; i < index; i++)
+            temp = temp->next;
     }
     else
     {
-        deleteNode = tail->previous;    // Start with element before tail.
-        for(int i = listSize-2; i > index; i--)
-            deleteNode = deleteNode->previous;
-        
-        deleteNode->previous->next = deleteNode->next;
-        deleteNode->next->previous = deleteNode->previous;
+        temp = tail;
+        for(int i = listSize-1; i > index; i--)
+            temp = temp->previous;
     }
     
-    T popped_data = deleteNode->data;
-    deleteNode->next = nullptr;
-    deleteNode->previous = nullptr;
-    delete deleteNode;
-    listSize--;
-    
-    return popped_data;
+    return temp;
 }
 
 /**
- * @brief   Returns, but does not remove, the head of the list.
+ * @brief   Returns the node located at the specified index of the list and moves the finger to it.
  *
  * @tparam T    Any data type or class.
- * @return      The data located at the head of the list.
+ * @param index Index of the node. Must be within range of the list.
+ * @return      The node located at the specified index.
  *
- * @throw   std::out_of_range
- * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ * @details Walks to the index with nodeAt(), so the next access near the index is quick.
  */
 template <typename T>
-T DLinkedList<T>::peek()
+DListNode<T>* DLinkedList<T>::moveFingerTo(const int index)
 {
-    if(head == nullptr)
-        throw std::out_of_range("Linked List is Empty");
-    
-    return head->data;
+    finger = nodeAt(index);
+    fingerIndex = index;
+    return finger;
 }
 
 /**
- * @brief   Returns, but does not remove, data from the list at the specified index.
+ * @brief   Unlinks the node located at the specified index from the list.
  *
  * @tparam T    Any data type or class.
- * @param index Index at which to retrieve data from the list.
- * @return      The data located at the specified index of the list.
+ * @param index Index of the node. Must be within range of the list.
+ * @return      The unlinked node, which still has to be destroyed.
  *
- * @throw   std::out_of_range
- * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ * @details The head and the tail are unlinked in constant time, any other node is found with moveFingerTo().
+ *          The finger stays on its element, or moves to the element that takes the place of the
+ *          unlinked one.
  */
 template <typename T>
-T DLinkedList<T>::peek(const int index)
+DListNode<T>* DLinkedList<T>::unlinkAt(const int index)
 {
-    if(head == nullptr)
-        throw std::out_of_range("Linked List is Empty");
-    else if(index < 0 || index >= listSize)
-        throw std::out_of_range("Index is out of range.");
-    else if(index == 0)
-        return head->data;
+    DListNode<T>* deleteNode;
+    if(index == 0)
+        deleteNode = head;
     else if(index == listSize-1)
-        return tail->data;
-    else if(index < listSize/2)
-    {
-        Node<T>* temp = head->next;     // Start with element after head.
-        for(int i = 1; i < index; i++)
-            temp = temp->next;
-        
-        return temp->data;
-    }
+        deleteNode = tail;
     else
+        deleteNode = moveFingerTo(index);
+    
+    if(finger == deleteNode)
     {
-        Node<T>* temp = tail->previous; // Start with element before tail.
-        for(int i = listSize-2; i > index; i--)
-            temp = temp->previous;
-        
-        return temp->data;
+        finger = deleteNode->next;
+        if(finger == nullptr)   // Removing the tail, fall back to the element before it.
+        {
+            finger = deleteNode->previous;
+            fingerIndex--;
+        }
     }
+    else if(finger != nullptr && index < fingerIndex)
+        fingerIndex--;
+    
+    if(deleteNode->previous == nullptr) // Removing the head of list.
+        head = deleteNode->next;
+    else
+        deleteNode->previous->next = deleteNode->next;
+    
+    if(deleteNode->next == nullptr)     // Removing the tail of list.
+        tail = deleteNode->previous;
+    else
+        deleteNode->next->previous = deleteNode->previous;
+    
+    listSize--;
+    return deleteNode;
 }
 
 /**
- * @brief   Returns the size of the list.
+ * @brief   Sets the previous pointer of every node, and the tail, from the next pointers.
  *
  * @tparam T    Any data type or class.
- * @return      The size of the list.
+ *
+ * @details Used after sort() rearranged the next pointers.
  */
 template <typename T>
-int DLinkedList<T>::size()
+void DLinkedList<T>::relinkPrevious()
 {
-    return listSize;
+    DListNode<T>* previous = nullptr;
+    for(DListNode<T>* node = head; node != nullptr; node = node->next)
+    {
+        node->previous = previous;
+        previous = node;
+    }
+    
+    tail = previous;
 }
 
 /**
- * @brief   Returns true if the list is empty and false otherwise.
+ * @brief   Makes sure that every node of another list belongs to the node pool of this list.
  *
  * @tparam T    Any data type or class.
- * @return      A boolean flag.
+ * @param other The other linked list.
+ *
+ * @details Shares the node pools in place when possible. Otherwise the elements of the other list
+ *          are moved into new nodes from the node pool of this list.
  */
 template <typename T>
-bool DLinkedList<T>::empty()
+void DLinkedList<T>::adoptNodes(DLinkedList<T>& other)
 {
-    return listSize == 0;
+    if(nodes.share(other.nodes))
+        return;
+    
+    DLinkedList<T> temp(nodes.getPool());
+    for(DListNode<T>* node = other.head; node; node = node->next)
+        temp.emplaceLast(std::move(node->data));
+    
+    other.clear();
+    other.swap(temp);
 }
 
 /**
@@ -541,8 +1786,8 @@ bool DLinkedList<T>::empty()
 template <typename T>
 void DLinkedList<T>::swap(DLinkedList<T>& other)
 {
-    Node<T>* tempHead = head;
-    Node<T>* tempTail = tail;
+    DListNode<T>* tempHead = head;
+    DListNode<T>* tempTail = tail;
     head = other.head;
     tail = other.tail;
     other.head = tempHead;
@@ -551,6 +1796,15 @@ void DLinkedList<T>::swap(DLinkedList<T>& other)
     int tempSize = listSize;
     listSize = other.listSize;
     other.listSize = tempSize;
+    
+    DListNode<T>* tempFinger = finger;
+    int tempFingerIndex = fingerIndex;
+    finger = other.finger;
+    fingerIndex = other.fingerIndex;
+    other.finger = tempFinger;
+    other.fingerIndex = tempFingerIndex;
+    
+    nodes.swap(other.nodes);
 }
 
 
@@ -576,26 +1830,12 @@ T& DLinkedList<T>::operator[](const int index)
         throw std::out_of_range("Linked List is Empty");
     else if(index < 0 || index >= listSize)
         throw std::out_of_range("Index is out of range.");
-    else if(index == 0)
-        return head->data;
-    else if(index == listSize-1)
-        return tail->data;
-    
-    Node<T>* temp;
-    if(index < listSize/2)
-    {
-        temp = head;
-        for(int i = 0; i < index; i++)
-            temp = temp->next;
-    }
-    else
-    {
-        temp = tail;
-        for(int i = listSize-1; i > index; i--)
-            temp = temp->previous;
-    }
-    
-    return temp->data;
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::SUBSCRIPT);
+    nodes.getStats().recordTraversal(ContainerStats::SUBSCRIPT, stepsTo(index));
+#endif
+
+    return moveFingerTo(index)->data;
 }
 
 /**
@@ -619,8 +1859,8 @@ bool DLinkedList<T>::operator==(const DLinkedList& compareList)
         return false;
     else
     {
-        Node<T>* currentNode = head;
-        Node<T>* compareNode = compareList.head;
+        DListNode<T>* currentNode = head;
+        DListNode<T>* compareNode = compareList.head;
         while(currentNode != nullptr && compareNode != nullptr)
         {
             if(currentNode->data != compareNode->data)
@@ -641,13 +1881,16 @@ bool DLinkedList<T>::operator==(const DLinkedList& compareList)
  * @param copyList  The linked list object from which to copy elements.
  * @return          A reference to a copied linked list object.
  *
- * @details Copies a linked list with the help of the copy constructor and a custom swap function.
+ * @details Overwrites the elements of the nodes this list already has and only creates,
+ *          or destroys, the nodes that make up the difference in size. If copying an element throws,
+ *          this list is left valid but only partly copied.
  */
 template <typename T>
 DLinkedList<T>& DLinkedList<T>::operator=(const DLinkedList& copyList)
 {
-    DLinkedList<T> tempList(copyList);
-    tempList.swap(*this);
+    if(this != &copyList)
+        copyFrom(copyList);
+    
     return *this;
 }
 
@@ -664,7 +1907,7 @@ DLinkedList<T>& DLinkedList<T>::operator=(const DLinkedList& copyList)
  * @note    std::move() needs to be used to call this operator.
  */
 template <typename T>
-DLinkedList<T>& DLinkedList<T>::operator=(DLinkedList&& moveList)
+DLinkedList<T>& DLinkedList<T>::operator=(DLinkedList&& moveList) noexcept
 {
     if(this == &moveList)   // Make this and moveList are not the same object.
         return *this;
@@ -685,7 +1928,8 @@ DLinkedList<T>& DLinkedList<T>::operator=(DLinkedList&& moveList)
  * @param output    The output stream (usually std::cout).
  * @param list      The linked list object that will be printed.
  *
- * @details Prints the list elements to the specified output stream.
+ * @details Prints the list elements to the specified output stream, with writeTo(), so the
+ *          list is walked iteratively and written in buffered chunks.
  *
  * @note    Any class or data type used with this linked list class MUST implement its
  *          own operator<< in order for this operator<< to work correctly. All primitive
@@ -696,8 +1940,11 @@ DLinkedList<T>& DLinkedList<T>::operator=(DLinkedList&& moveList)
 template <typename T>
 std::ostream& operator<<(std::ostream& output, const DLinkedList<T>& list)
 {
-    if (list.head)
-        return output << "(" << *list.head << ")";
-    else
-        return output << "()";
+    output << "(";
+    list.writeTo(output);
+    return output << ")";
 }
+
+} // namespace DataStructures
+
+#endif /* DLinkedList_hpp */
@@ -0,0 +1,1001 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    FixedBinaryTree.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic fixed capacity Binary Tree data structure that never allocates.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef FixedBinaryTree_hpp
+#define FixedBinaryTree_hpp
+
+#include <new>
+#include <utility>
+#include <iostream>
+#include <type_traits>
+#include <initializer_list>
+#include "SimdSearch.hpp"
+#include "FixedStorage.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   FixedBinaryTree
+ * @brief   A generic fixed capacity Binary Tree class.
+ * @details This Binary Tree class is templated to use any data type or class. Like ArrayBinaryTree,
+ *          the tree is always complete, so its elements are kept in level order in one array and the
+ *          children of the element at index i are at 2i+1 and 2i+2. The array is stored inside the
+ *          tree object itself, so the tree never allocates and every operation takes the same time
+ *          for the same size. It has the same interface as BinaryTree, so the two can be swapped for
+ *          one another, except that inserting into a full tree does nothing and returns false
+ *          instead of growing the tree.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ *
+ * @note    The default constructor is constexpr, so a global tree is constant initialized. With
+ *          trivially destructible elements the tree is trivially destructible, and an empty
+ *          tree can be a constexpr object.
+ * @note    parallelBfsearch(), depths() and heights() are left out, because they start threads
+ *          or return a vector, and this tree must not allocate.
+ */
+template <typename T, int Capacity>
+class FixedBinaryTree
+{
+    static_assert(Capacity > 0, "FixedBinaryTree needs room for at least one element.");
+    
+public:
+    // ---------- CONSTRUCTORS ----------
+    constexpr FixedBinaryTree();
+    template <typename Iterator>
+    FixedBinaryTree(Iterator first, Iterator last);
+    FixedBinaryTree(std::initializer_list<T> elements);
+    FixedBinaryTree(const FixedBinaryTree<T, Capacity>& copyTree);
+    FixedBinaryTree(FixedBinaryTree<T, Capacity>&& moveTree) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----------- FUNCTIONS ------------
+    bool insert(const T& element);
+    bool insert(T&& element);
+    template <typename... Args>
+    bool emplace(Args&&... args);
+    template <typename Iterator>
+    bool insertBulk(Iterator first, Iterator last);
+    bool bfsearch(const T& element);
+    bool dfsearch(const T& element);
+    void remove(const T& element);
+    void clear();
+    template <typename Iterator>
+    bool assign(Iterator first, Iterator last);
+    constexpr int size() const;
+    constexpr bool empty() const;
+    constexpr bool full() const;
+    static constexpr int capacity();
+    
+    int depth(const T& element);
+    int height(const T& element);
+    void invertTree();
+    
+    template <typename Function>
+    void forEachInorder(Function visit) const;
+    template <typename Function>
+    void forEachPreorder(Function visit) const;
+    template <typename Function>
+    void forEachPostorder(Function visit) const;
+    
+    void printInorder();
+    void printPreorder();
+    void printPostorder();
+    
+    // ----------- OPERATORS ------------
+    FixedBinaryTree<T, Capacity>& operator=(const FixedBinaryTree& copyTree);
+    FixedBinaryTree<T, Capacity>& operator=(FixedBinaryTree&& moveTree) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, int TypeCapacity>
+    friend std::ostream& operator<<(std::ostream& output, const FixedBinaryTree<Type, TypeCapacity>& tree);
+    
+private:
+    /**
+     * @struct  Fields
+     * @brief   The fields of the tree, which FixedFields destroys the elements of.
+     */
+    struct Fields
+    {
+        FixedSlots<T, Capacity> slots;  /**< The elements in level order, as if the tree was never inverted. */
+        int treeSize;                   /**< The size of the tree. */
+        bool inverted;                  /**< True if the tree is mirrored, so every level fills from right to left. */
+        
+        /** Default Constructor. */
+        constexpr Fields() : slots(), treeSize(0), inverted(false) {}
+        /** Destroys every element of the tree, from the last one in level order to the root. */
+        void destroyElements()
+        {
+            for(int i = treeSize-1; i >= 0; i--)
+                slots.elements[i].~T();
+        }
+    };
+    
+    // ------------- FIELDS -------------
+    FixedFields<Fields, std::is_trivially_destructible<T>::value> fields;   /**< The elements and the shape of the tree. */
+    
+    // ----------- FUNCTIONS ------------
+    int indexOf(const T& element) const;
+    int leftChild(const int index) const;
+    int rightChild(const int index) const;
+    int inorderFirst(int index) const;
+    int inorderNext(int index) const;
+    int preorderNext(int index) const;
+    int postorderFirst(int index) const;
+    int postorderNext(int index) const;
+    void print(std::ostream& output, const char& printOrder) const;
+    void copyFrom(const FixedBinaryTree<T, Capacity>& copyTree);
+    void moveFrom(FixedBinaryTree<T, Capacity>& other);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ *
+ * @details Initializes this tree object with no elements, without constructing any element.
+ */
+template <typename T, int Capacity>
+constexpr FixedBinaryTree<T, Capacity>::FixedBinaryTree() : fields() {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ *
+ * @details See insertBulk(). No duplicates allowed.
+ *
+ * @note    Insertion stops at the first element that does not fit, check size() to find out if
+ *          any of the range was left out.
+ */
+template <typename T, int Capacity>
+template <typename Iterator>
+FixedBinaryTree<T, Capacity>::FixedBinaryTree(Iterator first, Iterator last) : FixedBinaryTree()
+{
+    insertBulk(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param elements  The elements of the tree, in level order.
+ *
+ * @details No duplicates allowed. Insertion stops at the first element that does not fit.
+ */
+template <typename T, int Capacity>
+FixedBinaryTree<T, Capacity>::FixedBinaryTree(std::initializer_list<T> elements) : FixedBinaryTree()
+{
+    insertBulk(elements.begin(), elements.end());
+}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param copyTree  The tree whose contents will be copied into this tree object.
+ */
+template <typename T, int Capacity>
+FixedBinaryTree<T, Capacity>::FixedBinaryTree(const FixedBinaryTree<T, Capacity>& copyTree) : FixedBinaryTree()
+{
+    copyFrom(copyTree);
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param moveTree  The tree whose contents will be moved into this tree object.
+ *
+ * @details The elements live inside the tree objects, so they are moved one by one.
+ *          The provided tree object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, int Capacity>
+FixedBinaryTree<T, Capacity>::FixedBinaryTree(FixedBinaryTree<T, Capacity>&& moveTree) noexcept(std::is_nothrow_move_constructible<T>::value) : FixedBinaryTree()
+{
+    moveFrom(moveTree);
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Inserts element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element you want to add to the tree.
+ * @return          False if the tree is full and the element is not in it yet, otherwise true.
+ *
+ * @details Breadth First insertion. No duplicates allowed.
+ */
+template <typename T, int Capacity>
+bool FixedBinaryTree<T, Capacity>::insert(const T& element)
+{
+    if(indexOf(element) != -1)
+        return true;
+    else if(fields.treeSize == Capacity)
+        return false;
+    
+    new (fields.slots.elements + fields.treeSize) T(element);
+    fields.treeSize++;
+    return true;
+}
+
+/**
+ * @brief   Moves element into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element you want to move into the tree.
+ * @return          False if the tree is full and the element is not in it yet, otherwise true.
+ *
+ * @details Breadth First insertion. No duplicates allowed.
+ */
+template <typename T, int Capacity>
+bool FixedBinaryTree<T, Capacity>::insert(T&& element)
+{
+    if(indexOf(element) != -1)
+        return true;
+    else if(fields.treeSize == Capacity)
+        return false;
+    
+    new (fields.slots.elements + fields.treeSize) T(std::move(element));
+    fields.treeSize++;
+    return true;
+}
+
+/**
+ * @brief   Constructs element in place and inserts it into the tree in level order, at first available position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the element.
+ * @return          False if the tree is full and the element is not in it yet, otherwise true.
+ *
+ * @details Breadth First insertion. No duplicates allowed, a duplicate element is destroyed again.
+ *          The first available position is always the end of the array. In a full tree the element
+ *          is constructed on the stack instead, only to look for it.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+bool FixedBinaryTree<T, Capacity>::emplace(Args&&... args)
+{
+    if(fields.treeSize == Capacity)
+        return indexOf(T(std::forward<Args>(args)...)) != -1;
+    
+    T* element = new (fields.slots.elements + fields.treeSize) T(std::forward<Args>(args)...);
+    if(indexOf(*element) == -1)
+        fields.treeSize++;
+    else                        // Element is a duplicate.
+        element->~T();
+    
+    return true;
+}
+
+/**
+ * @brief   Inserts every element of a range into the tree in level order.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ * @return          True if every element of the range is in the tree, false if the tree filled up first.
+ *
+ * @details No duplicates allowed. Insertion stops at the first element that does not fit.
+ */
+template <typename T, int Capacity>
+template <typename Iterator>
+bool FixedBinaryTree<T, Capacity>::insertBulk(Iterator first, Iterator last)
+{
+    for(; first != last; ++first)
+        if(!insert(*first))
+            return false;
+    
+    return true;
+}
+
+/**
+ * @brief   Breadth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the tree, otherwise returns false.
+ *          The array already is in level order, so this is a linear scan.
+ */
+template <typename T, int Capacity>
+bool FixedBinaryTree<T, Capacity>::bfsearch(const T& element)
+{
+    return indexOf(element) != -1;
+}
+
+/**
+ * @brief   Depth First Search.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element being searched for in the tree.
+ * @return          A boolean flag.
+ *
+ * @details Returns true if the element is in the tree, otherwise returns false.
+ *
+ * @note    This Depth First Search uses inorder traversal. It moves between parent and child
+ *          indices, so it needs no stack.
+ */
+template <typename T, int Capacity>
+bool FixedBinaryTree<T, Capacity>::dfsearch(const T& element)
+{
+    if(fields.treeSize == 0)
+        return false;
+    
+    for(int index = inorderFirst(0); index != -1; index = inorderNext(index))
+        if(fields.slots.elements[index] == element)
+            return true;
+    
+    return false;
+}
+
+/**
+ * @brief   Removes the specified element from the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element to be removed from the tree.
+ *
+ * @details The element is overwritten with the deepest element, which is always the last element of the array.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::remove(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // If element doesn't exist in the tree.
+        return;
+    
+    T* last = fields.slots.elements + fields.treeSize - 1;
+    if(index != fields.treeSize - 1)
+        fields.slots.elements[index] = std::move(*last);
+    last->~T();
+    fields.treeSize--;
+    
+    if(fields.treeSize == 0)
+        fields.inverted = false;
+}
+
+/**
+ * @brief   Clears the entire tree and resets all field elements to default.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::clear()
+{
+    fields.destroyElements();
+    fields.treeSize = 0;
+    fields.inverted = false;
+}
+
+/**
+ * @brief   Replaces the elements of the tree with the elements of a range.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Iterator An input iterator over elements of type T.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ * @return          True if every element of the range is in the tree, false if the tree filled up first.
+ *
+ * @details The tree is cleared first, then the range is inserted with insertBulk().
+ */
+template <typename T, int Capacity>
+template <typename Iterator>
+bool FixedBinaryTree<T, Capacity>::assign(Iterator first, Iterator last)
+{
+    clear();
+    return insertBulk(first, last);
+}
+
+/**
+ * @brief   Returns the size of/number of elements in the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @return          The size of the tree.
+ */
+template <typename T, int Capacity>
+constexpr int FixedBinaryTree<T, Capacity>::size() const
+{
+    return fields.treeSize;
+}
+
+/**
+ * @brief   Returns true if the tree is empty and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedBinaryTree<T, Capacity>::empty() const
+{
+    return fields.treeSize == 0;
+}
+
+/**
+ * @brief   Returns true if the tree is full and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedBinaryTree<T, Capacity>::full() const
+{
+    return fields.treeSize == Capacity;
+}
+
+/**
+ * @brief   Returns the number of elements the tree can hold.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @return          The capacity of the tree.
+ */
+template <typename T, int Capacity>
+constexpr int FixedBinaryTree<T, Capacity>::capacity()
+{
+    return Capacity;
+}
+
+/**
+ * @brief   Returns depth of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element whose depth we are calculating.
+ * @return          Depth of element, or -1 if the element is not in the tree.
+ *
+ * @details The depth of the element at index i is floor(log2(i+1)).
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::depth(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // Tree is empty or element was not found.
+        return -1;
+    
+    int depth = 0;
+    for(int position = index + 1; position > 1; position /= 2)
+        depth++;
+    
+    return depth;
+}
+
+/**
+ * @brief   Returns height of the specified element in tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element whose height we are calculating.
+ * @return          Height of element, or -1 if the element is not in the tree.
+ *
+ * @details In a complete tree the deepest path below an element always starts by going
+ *          to the first filled child, so the height is the number of those steps.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::height(const T& element)
+{
+    int index = indexOf(element);
+    if(index == -1)     // Tree is empty or element was not found.
+        return -1;
+    
+    int height = 0;
+    for(int child = 2*index + 1; child < fields.treeSize; child = 2*child + 1)
+        height++;
+    
+    return height;
+}
+
+/**
+ * @brief   Inverts the tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ *
+ * @details The elements stay where they are, only the meaning of the two child indices is swapped.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::invertTree()
+{
+    if(fields.treeSize > 0)
+        fields.inverted = !fields.inverted;
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal moves between parent and child indices, so it needs no stack.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T, int Capacity>
+template <typename Function>
+void FixedBinaryTree<T, Capacity>::forEachInorder(Function visit) const
+{
+    if(fields.treeSize == 0)
+        return;
+    
+    for(int index = inorderFirst(0); index != -1; index = inorderNext(index))
+        visit(static_cast<const T&>(fields.slots.elements[index]));
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal moves between parent and child indices, so it needs no stack.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T, int Capacity>
+template <typename Function>
+void FixedBinaryTree<T, Capacity>::forEachPreorder(Function visit) const
+{
+    if(fields.treeSize == 0)
+        return;
+    
+    for(int index = 0; index != -1; index = preorderNext(index))
+        visit(static_cast<const T&>(fields.slots.elements[index]));
+}
+
+/**
+ * @brief   Calls a function with every element of the tree, in postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @tparam Function A callable that takes a const reference to an element.
+ * @param visit     The function called with every element.
+ *
+ * @details The traversal moves between parent and child indices, so it needs no stack.
+ *
+ * @warning The tree must not be changed by the function.
+ */
+template <typename T, int Capacity>
+template <typename Function>
+void FixedBinaryTree<T, Capacity>::forEachPostorder(Function visit) const
+{
+    if(fields.treeSize == 0)
+        return;
+    
+    for(int index = postorderFirst(0); index != -1; index = postorderNext(index))
+        visit(static_cast<const T&>(fields.slots.elements[index]));
+}
+
+/**
+ * @brief   Prints tree Inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::printInorder()
+{
+    if(fields.treeSize == 0)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << fields.slots.elements[0] << "]\t" << "(";
+    print(std::cout, 'i');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::printPreorder()
+{
+    if(fields.treeSize == 0)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << fields.slots.elements[0] << "]\t" << "(";
+    print(std::cout, 'r');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Prints tree Postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::printPostorder()
+{
+    if(fields.treeSize == 0)
+    {
+        std::cout << "()" << std::endl;
+        return;
+    }
+    
+    std::cout << "[root: " << fields.slots.elements[0] << "]\t" << "(";
+    print(std::cout, 'o');
+    std::cout << ")" << std::endl;
+}
+
+/**
+ * @brief   Returns the index of the specified element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param element   The element being searched for in the tree.
+ * @return          The index of the element, or -1 if the element is not in the tree.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::indexOf(const T& element) const
+{
+    return SimdSearch::find(fields.slots.elements, fields.treeSize, element);
+}
+
+/**
+ * @brief   Returns the index of the left child of an element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the element.
+ * @return          The index of the left child, or -1 if there is no left child.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::leftChild(const int index) const
+{
+    int child = fields.inverted ? 2*index + 2 : 2*index + 1;
+    return (child < fields.treeSize) ? child : -1;
+}
+
+/**
+ * @brief   Returns the index of the right child of an element.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the element.
+ * @return          The index of the right child, or -1 if there is no right child.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::rightChild(const int index) const
+{
+    int child = fields.inverted ? 2*index + 1 : 2*index + 2;
+    return (child < fields.treeSize) ? child : -1;
+}
+
+/**
+ * @brief   Returns the first element of a subtree in inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the root of the subtree.
+ * @return          The index of the leftmost element of the subtree.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::inorderFirst(int index) const
+{
+    for(int child = leftChild(index); child != -1; child = leftChild(index))
+        index = child;
+    
+    return index;
+}
+
+/**
+ * @brief   Returns the element that follows an element in inorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the current element.
+ * @return          The index of the next element, or -1 if the current element is the last one.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::inorderNext(int index) const
+{
+    int child = rightChild(index);
+    if(child != -1)
+        return inorderFirst(child);
+    
+    // Climb until we come up from a left subtree.
+    while(index != 0)
+    {
+        int parent = (index - 1) / 2;
+        if(leftChild(parent) == index)
+            return parent;
+        index = parent;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief   Returns the element that follows an element in preorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the current element.
+ * @return          The index of the next element, or -1 if the current element is the last one.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::preorderNext(int index) const
+{
+    int child = leftChild(index);
+    if(child == -1)
+        child = rightChild(index);
+    if(child != -1)
+        return child;
+    
+    // Climb until we come up from a left subtree that has a right sibling.
+    while(index != 0)
+    {
+        int parent = (index - 1) / 2;
+        int sibling = rightChild(parent);
+        if(leftChild(parent) == index && sibling != -1)
+            return sibling;
+        index = parent;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief   Returns the first element of a subtree in postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the root of the subtree.
+ * @return          The index of the deepest element reached by always going left when possible.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::postorderFirst(int index) const
+{
+    while(true)
+    {
+        int child = leftChild(index);
+        if(child == -1)
+            child = rightChild(index);
+        if(child == -1)
+            return index;
+        index = child;
+    }
+}
+
+/**
+ * @brief   Returns the element that follows an element in postorder.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param index     The index of the current element.
+ * @return          The index of the next element, or -1 if the current element is the root.
+ */
+template <typename T, int Capacity>
+int FixedBinaryTree<T, Capacity>::postorderNext(int index) const
+{
+    if(index == 0)
+        return -1;
+    
+    int parent = (index - 1) / 2;
+    int sibling = rightChild(parent);
+    if(leftChild(parent) == index && sibling != -1)     // The right subtree of the parent comes next.
+        return postorderFirst(sibling);
+    
+    return parent;
+}
+
+/**
+ * @brief   Prints the elements of the tree, separated by commas.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the tree can hold.
+ * @param output        The output stream.
+ * @param printOrder    The order in which to print the tree (In-, Pre-, Post- order).
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::print(std::ostream& output, const char& printOrder) const
+{
+    const char* separator = "";
+    auto printElement = [&output, &separator](const T& element)
+    {
+        output << separator << element;
+        separator = ", ";
+    };
+    
+    switch (printOrder)
+    {
+        case 'i':   // Inorder
+            forEachInorder(printElement);
+            break;
+        case 'r':   // Preorder
+            forEachPreorder(printElement);
+            break;
+        case 'o':   // Postorder
+            forEachPostorder(printElement);
+            break;
+    }
+}
+
+/**
+ * @brief   Copies the elements of another tree into this tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param copyTree  The tree whose elements will be copied into this tree object.
+ *
+ * @details Assigns to the elements this tree already has and only constructs, or destroys,
+ *          the elements that make up the difference in size.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::copyFrom(const FixedBinaryTree<T, Capacity>& copyTree)
+{
+    while(fields.treeSize > copyTree.fields.treeSize)
+        fields.slots.elements[--fields.treeSize].~T();
+    
+    for(int i = 0; i < fields.treeSize; i++)
+        fields.slots.elements[i] = copyTree.fields.slots.elements[i];
+    
+    while(fields.treeSize < copyTree.fields.treeSize)
+    {
+        new (fields.slots.elements + fields.treeSize) T(copyTree.fields.slots.elements[fields.treeSize]);
+        fields.treeSize++;
+    }
+    
+    fields.inverted = copyTree.fields.inverted;
+}
+
+/**
+ * @brief   Moves the elements of another tree into this empty tree.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param other     The tree whose elements will be moved. It is empty afterwards.
+ */
+template <typename T, int Capacity>
+void FixedBinaryTree<T, Capacity>::moveFrom(FixedBinaryTree<T, Capacity>& other)
+{
+    for(int i = 0; i < other.fields.treeSize; i++)
+    {
+        new (fields.slots.elements + i) T(std::move(other.fields.slots.elements[i]));
+        fields.treeSize++;
+    }
+    
+    fields.inverted = other.fields.inverted;
+    other.clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param copyTree  The tree object from which to copy elements.
+ * @return          A reference to a copied tree object.
+ *
+ * @details Assigns to the elements this tree already has. If copying an element throws,
+ *          this tree is left valid but only partly copied.
+ */
+template <typename T, int Capacity>
+FixedBinaryTree<T, Capacity>& FixedBinaryTree<T, Capacity>::operator=(const FixedBinaryTree& copyTree)
+{
+    if(this != &copyTree)
+        copyFrom(copyTree);
+    
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param moveTree  The tree object from which to move elements.
+ * @return          A reference to a moved tree object.
+ *
+ * @details Moves tree elements from the provided tree into this tree object.
+ *          The provided tree object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, int Capacity>
+FixedBinaryTree<T, Capacity>& FixedBinaryTree<T, Capacity>::operator=(FixedBinaryTree&& moveTree) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if(this == &moveTree)   // Make sure this and moveTree are not the same object.
+        return *this;
+    
+    clear();
+    moveFrom(moveTree);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the tree can hold.
+ * @param output    The output stream (usually std::cout).
+ * @param tree      The tree object that will be printed.
+ *
+ * @details Prints the tree elements to the specified output stream using inorder traversal.
+ *
+ * @note    Any class or data type used with this tree class MUST implement its own
+ *          operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this tree class NEEDS to implement its own operator<<.
+ */
+template <typename T, int Capacity>
+std::ostream& operator<<(std::ostream& output, const FixedBinaryTree<T, Capacity>& tree)
+{
+    if(tree.fields.treeSize == 0)
+        return output << "()";
+    
+    output << "[root: " << tree.fields.slots.elements[0] << "]\t" << "(";
+    tree.print(output, 'i');
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* FixedBinaryTree_hpp */
@@ -0,0 +1,1249 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    FixedList.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic fixed capacity Doubly Linked List data structure that never allocates.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef FixedList_hpp
+#define FixedList_hpp
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+#include "FixedStorage.hpp"
+
+namespace DataStructures
+{
+
+template <typename T, int Capacity>
+class FixedList;
+
+/**
+ * @class   FixedListIterator
+ * @brief   A bidirectional iterator over the elements of a FixedList.
+ * @details Refers to an element by the index of its slot, so the iterator stays valid until that
+ *          element is removed, no matter what else is added to or removed from the list.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam IsConst  True for a const_iterator, false for an iterator.
+ */
+template <typename T, int Capacity, bool IsConst>
+class FixedListIterator
+{
+public:
+    // -------------- TYPES -------------
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+    typedef typename std::conditional<IsConst, const T&, T&>::type reference;
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Default Constructor. */
+    FixedListIterator() : slot(-1), list(nullptr) {}
+    /** Conversion Constructor from a mutable iterator to a constant iterator. */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    FixedListIterator(const FixedListIterator<T, Capacity, OtherConst>& other) : slot(other.slot), list(other.list) {}
+    
+    // ----------- OPERATORS ------------
+    reference operator*() const { return list->fields.slots.elements[slot]; }
+    pointer operator->() const { return &list->fields.slots.elements[slot]; }
+    FixedListIterator& operator++()
+    {
+        slot = list->fields.links.elements[slot].next;
+        return *this;
+    }
+    FixedListIterator operator++(int)
+    {
+        FixedListIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    FixedListIterator& operator--()
+    {
+        slot = (slot == -1) ? list->fields.tail : list->fields.links.elements[slot].previous;
+        return *this;
+    }
+    FixedListIterator operator--(int)
+    {
+        FixedListIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+    template <bool OtherConst>
+    bool operator==(const FixedListIterator<T, Capacity, OtherConst>& other) const { return slot == other.slot; }
+    template <bool OtherConst>
+    bool operator!=(const FixedListIterator<T, Capacity, OtherConst>& other) const { return slot != other.slot; }
+    
+private:
+    // -------------- TYPES -------------
+    typedef typename std::conditional<IsConst, const FixedList<T, Capacity>, FixedList<T, Capacity>>::type ListType;
+    
+    // ------------- FIELDS -------------
+    int slot;           /**< The slot of the current element, -1 past the end of the list. */
+    ListType* list;     /**< The list the iterator belongs to. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Slot Constructor. */
+    FixedListIterator(const int slot, ListType* list) : slot(slot), list(list) {}
+    
+    friend class FixedList<T, Capacity>;
+    friend class FixedListIterator<T, Capacity, !IsConst>;
+};
+
+/**
+ * @class   FixedList
+ * @brief   A generic fixed capacity Doubly Linked List class.
+ * @details This Linked List class is templated to use any data type or class. Every element is
+ *          stored in a slot inside the list object itself, and the slots are linked to each other
+ *          by index, so the list never allocates and adding or removing an element takes the same
+ *          time every time. A removed element's slot is reused by the next element that is added.
+ *          It has the same interface as SLinkedList and DLinkedList, so they can be swapped for one
+ *          another, except that adding an element to a full list does nothing and returns false
+ *          (or end() for insertAfter() and emplaceAfter()) instead of growing the list.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ *
+ * @note    The default constructor is constexpr, so a global list is constant initialized. With
+ *          trivially destructible elements the list is trivially destructible, and an empty
+ *          list can be a constexpr object.
+ * @note    splice(), splitAt() and merge() are left out, because they relink nodes between two
+ *          lists and the slots of one list cannot be handed to another.
+ */
+template <typename T, int Capacity>
+class FixedList
+{
+    static_assert(Capacity > 0, "FixedList needs room for at least one element.");
+    
+public:
+    // -------------- TYPES -------------
+    typedef FixedListIterator<T, Capacity, false> iterator;
+    typedef FixedListIterator<T, Capacity, true> const_iterator;
+    
+    // ---------- CONSTRUCTORS ----------
+    constexpr FixedList();
+    template <typename InputIterator>
+    FixedList(InputIterator first, InputIterator last);
+    FixedList(std::initializer_list<T> elements);
+    FixedList(const FixedList<T, Capacity>& copyList);
+    FixedList(FixedList<T, Capacity>&& moveList) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----------- FUNCTIONS ------------
+    bool addFirst(const T& data);
+    bool addFirst(T&& data);
+    bool addLast(const T& data);
+    bool addLast(T&& data);
+    bool insert(const T& data, const int index);
+    bool insert(T&& data, const int index);
+    template <typename... Args>
+    bool emplaceFirst(Args&&... args);
+    template <typename... Args>
+    bool emplaceLast(Args&&... args);
+    template <typename... Args>
+    bool emplace(const int index, Args&&... args);
+    void remove(const int index);
+    iterator insertAfter(const_iterator position, const T& data);
+    iterator insertAfter(const_iterator position, T&& data);
+    template <typename... Args>
+    iterator emplaceAfter(const_iterator position, Args&&... args);
+    iterator erase(const_iterator position);
+    void clear();
+    template <typename InputIterator>
+    bool assign(InputIterator first, InputIterator last);
+    T pop();
+    T pop(const int index);
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    T& peek(const int index);
+    const T& peek(const int index) const;
+    constexpr int size() const;
+    constexpr bool empty() const;
+    constexpr bool full() const;
+    static constexpr int capacity();
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
+    
+    // ----------- OPERATORS ------------
+    T& operator[](const int index);
+    bool operator==(const FixedList& compareList);
+    FixedList<T, Capacity>& operator=(const FixedList& copyList);
+    FixedList<T, Capacity>& operator=(FixedList&& moveList) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, int TypeCapacity>
+    friend std::ostream& operator<<(std::ostream& output, const FixedList<Type, TypeCapacity>& list);
+    
+private:
+    /**
+     * @struct  Link
+     * @brief   The slots before and after a slot, -1 if there is none.
+     */
+    struct Link
+    {
+        int next;       /**< The slot of the next element, or of the next free slot. */
+        int previous;   /**< The slot of the previous element. */
+    };
+    
+    /**
+     * @struct  Fields
+     * @brief   The fields of the list, which FixedFields destroys the elements of.
+     * @details The slots below usedSlots were handed out before, and the free ones among them are
+     *          chained through Link::next starting at freeSlot. The slots from usedSlots up have never
+     *          been used, so their links never have to be initialized.
+     */
+    struct Fields
+    {
+        FixedSlots<T, Capacity> slots;      /**< The elements. Only the slots linked into the list hold one. */
+        FixedSlots<Link, Capacity> links;   /**< The links of every slot below usedSlots. */
+        int head;                           /**< The slot of the head of the list. */
+        int tail;                           /**< The slot of the tail of the list. */
+        int listSize;                       /**< The size of the list. */
+        int freeSlot;                       /**< The first free slot below usedSlots. */
+        int usedSlots;                      /**< The number of slots that were ever handed out. */
+        
+        /** Default Constructor. */
+        constexpr Fields() : slots(), links(), head(-1), tail(-1), listSize(0), freeSlot(-1), usedSlots(0) {}
+        /** Destroys every element of the list, from the head to the tail. */
+        void destroyElements()
+        {
+            for(int slot = head; slot != -1; slot = links.elements[slot].next)
+                slots.elements[slot].~T();
+        }
+    };
+    
+    // ------------- FIELDS -------------
+    FixedFields<Fields, std::is_trivially_destructible<T>::value> fields;   /**< The elements and links of the list. */
+    
+    // ----------- FUNCTIONS ------------
+    template <typename... Args>
+    int createSlot(Args&&... args);
+    void destroySlot(const int slot);
+    void link(const int slot, const int previous, const int next);
+    void unlink(const int slot);
+    int slotAt(const int index) const;
+    void copyFrom(const FixedList<T, Capacity>& copyList);
+    void moveFrom(FixedList<T, Capacity>& other);
+    
+    friend class FixedListIterator<T, Capacity, false>;
+    friend class FixedListIterator<T, Capacity, true>;
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ *
+ * @details Initializes this list object with no head or tail and a size of 0,
+ *          without constructing any element.
+ */
+template <typename T, int Capacity>
+constexpr FixedList<T, Capacity>::FixedList() : fields() {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam Capacity         The number of elements the list can hold.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @note    Only the first Capacity elements of the range are added, check size() to find out if that
+ *          was all of them.
+ */
+template <typename T, int Capacity>
+template <typename InputIterator>
+FixedList<T, Capacity>::FixedList(InputIterator first, InputIterator last) : FixedList()
+{
+    assign(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param elements  The elements of the list, in order.
+ *
+ * @note    Only the first Capacity elements are added.
+ */
+template <typename T, int Capacity>
+FixedList<T, Capacity>::FixedList(std::initializer_list<T> elements) : FixedList()
+{
+    assign(elements.begin(), elements.end());
+}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param copyList  The list whose elements will be copied into this list object.
+ */
+template <typename T, int Capacity>
+FixedList<T, Capacity>::FixedList(const FixedList<T, Capacity>& copyList) : FixedList()
+{
+    copyFrom(copyList);
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param moveList  The list whose elements will be moved into this list object.
+ *
+ * @details The elements live inside the list objects, so they are moved one by one.
+ *          The provided list object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, int Capacity>
+FixedList<T, Capacity>::FixedList(FixedList<T, Capacity>&& moveList) noexcept(std::is_nothrow_move_constructible<T>::value) : FixedList()
+{
+    moveFrom(moveList);
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds data to the front of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to add to the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::addFirst(const T& data)
+{
+    return emplaceFirst(data);
+}
+
+/**
+ * @brief   Moves data to the front of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to move into the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::addFirst(T&& data)
+{
+    return emplaceFirst(std::move(data));
+}
+
+/**
+ * @brief   Adds data to the end of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to add to the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::addLast(const T& data)
+{
+    return emplaceLast(data);
+}
+
+/**
+ * @brief   Moves data to the end of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to move into the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::addLast(T&& data)
+{
+    return emplaceLast(std::move(data));
+}
+
+/**
+ * @brief   Adds data to the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to add to the list.
+ * @param index     Index at which to add the data into the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::insert(const T& data, const int index)
+{
+    return emplace(index, data);
+}
+
+/**
+ * @brief   Moves data into the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param data      The data you want to move into the list.
+ * @param index     Index at which to add the data into the list.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::insert(T&& data, const int index)
+{
+    return emplace(index, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place at the front of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+bool FixedList<T, Capacity>::emplaceFirst(Args&&... args)
+{
+    int slot = createSlot(std::forward<Args>(args)...);
+    if(slot == -1)
+        return false;
+    
+    link(slot, -1, fields.head);
+    return true;
+}
+
+/**
+ * @brief   Constructs data in place at the end of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+bool FixedList<T, Capacity>::emplaceLast(Args&&... args)
+{
+    int slot = createSlot(std::forward<Args>(args)...);
+    if(slot == -1)
+        return false;
+    
+    link(slot, fields.tail, -1);
+    return true;
+}
+
+/**
+ * @brief   Constructs data in place at the specified index of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param index     Index at which to add the data into the list.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          True if the data was added, false if the list is full.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+bool FixedList<T, Capacity>::emplace(const int index, Args&&... args)
+{
+    if(index <= 0)
+        return emplaceFirst(std::forward<Args>(args)...);
+    else if(index >= fields.listSize)
+        return emplaceLast(std::forward<Args>(args)...);
+    
+    int slot = createSlot(std::forward<Args>(args)...);
+    if(slot == -1)
+        return false;
+    
+    int nextSlot = slotAt(index);
+    link(slot, fields.links.elements[nextSlot].previous, nextSlot);
+    return true;
+}
+
+/**
+ * @brief   Removes data from the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index at which to remove data from the list.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::remove(const int index)
+{
+    // Do nothing if list is empty or index out of range.
+    if(fields.listSize == 0 || index < 0 || index >= fields.listSize)
+        return;
+    
+    int slot = slotAt(index);
+    unlink(slot);
+    destroySlot(slot);
+}
+
+/**
+ * @brief   Adds data to the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to add to the list.
+ * @return          An iterator to the added data, or end() if the list is full.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::insertAfter(const_iterator position, const T& data)
+{
+    return emplaceAfter(position, data);
+}
+
+/**
+ * @brief   Moves data into the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to move into the list.
+ * @return          An iterator to the added data, or end() if the list is full.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::insertAfter(const_iterator position, T&& data)
+{
+    return emplaceAfter(position, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param position  Iterator to the element after which to add the data.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          An iterator to the added data, or end() if the list is full.
+ *
+ * @details Links the new slot in constant time, without walking the list.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::emplaceAfter(const_iterator position, Args&&... args)
+{
+    int slot = createSlot(std::forward<Args>(args)...);
+    if(slot == -1)
+        return end();
+    
+    link(slot, position.slot, fields.links.elements[position.slot].next);
+    return iterator(slot, this);
+}
+
+/**
+ * @brief   Removes the data at the specified position from the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param position  Iterator to the element to remove.
+ * @return          An iterator to the element that followed the removed one.
+ *
+ * @details Unlinks the slot in constant time, without walking the list.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::erase(const_iterator position)
+{
+    int nextSlot = fields.links.elements[position.slot].next;
+    unlink(position.slot);
+    destroySlot(position.slot);
+    return iterator(nextSlot, this);
+}
+
+/**
+ * @brief   Clears the entire list and resets all field elements to default.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ *
+ * @details Every slot is free afterwards, so the next elements are added to the slots in order again.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::clear()
+{
+    fields.destroyElements();
+    fields.head = -1;
+    fields.tail = -1;
+    fields.listSize = 0;
+    fields.freeSlot = -1;
+    fields.usedSlots = 0;
+}
+
+/**
+ * @brief   Replaces the elements of the list with the elements of a range.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam Capacity         The number of elements the list can hold.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ * @return                  True if every element of the range was added, false if the list filled up first.
+ *
+ * @details The list is cleared first. If the range does not fit, the list holds its first Capacity elements.
+ */
+template <typename T, int Capacity>
+template <typename InputIterator>
+bool FixedList<T, Capacity>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    for(; first != last; ++first)
+        if(!emplaceLast(*first))
+            return false;
+    
+    return true;
+}
+
+/**
+ * @brief   Removes and returns the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          The removed data.
+ *
+ * @details The data is moved out of the removed slot, not copied.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int Capacity>
+T FixedList<T, Capacity>::pop()
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    
+    int slot = fields.head;
+    T popped_data = std::move(fields.slots.elements[slot]);
+    unlink(slot);
+    destroySlot(slot);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes and returns data from the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index at which to retrieve and remove data from the list.
+ * @return          The removed data.
+ *
+ * @details The data is moved out of the removed slot, not copied.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int Capacity>
+T FixedList<T, Capacity>::pop(const int index)
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= fields.listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    int slot = slotAt(index);
+    T popped_data = std::move(fields.slots.elements[slot]);
+    unlink(slot);
+    destroySlot(slot);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes the head of the list and moves it into the provided variable.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param out       The variable that receives the removed data.
+ * @return          True if data was removed, false if the list is empty.
+ *
+ * @details Works like pop() but reports an empty list through the return value instead of throwing.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::tryPop(T& out)
+{
+    if(fields.head == -1)
+        return false;
+    
+    int slot = fields.head;
+    out = std::move(fields.slots.elements[slot]);
+    unlink(slot);
+    destroySlot(slot);
+    
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int Capacity>
+T& FixedList<T, Capacity>::peek()
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return fields.slots.elements[fields.head];
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A constant reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int Capacity>
+const T& FixedList<T, Capacity>::peek() const
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return fields.slots.elements[fields.head];
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index at which to retrieve data from the list.
+ * @return          A reference to the data located at the specified index in the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int Capacity>
+T& FixedList<T, Capacity>::peek(const int index)
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= fields.listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    return fields.slots.elements[slotAt(index)];
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index at which to retrieve data from the list.
+ * @return          A constant reference to the data located at the specified index in the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int Capacity>
+const T& FixedList<T, Capacity>::peek(const int index) const
+{
+    if(fields.head == -1)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= fields.listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    return fields.slots.elements[slotAt(index)];
+}
+
+/**
+ * @brief   Returns the size of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          The size of the list.
+ */
+template <typename T, int Capacity>
+constexpr int FixedList<T, Capacity>::size() const
+{
+    return fields.listSize;
+}
+
+/**
+ * @brief   Returns true if the list is empty and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedList<T, Capacity>::empty() const
+{
+    return fields.listSize == 0;
+}
+
+/**
+ * @brief   Returns true if the list is full and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedList<T, Capacity>::full() const
+{
+    return fields.listSize == Capacity;
+}
+
+/**
+ * @brief   Returns the number of elements the list can hold.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          The capacity of the list.
+ */
+template <typename T, int Capacity>
+constexpr int FixedList<T, Capacity>::capacity()
+{
+    return Capacity;
+}
+
+/**
+ * @brief   Returns an iterator to the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          An iterator to the first element, or end() if the list is empty.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::begin()
+{
+    return iterator(fields.head, this);
+}
+
+/**
+ * @brief   Returns a constant iterator to the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A constant iterator to the first element, or end() if the list is empty.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::const_iterator FixedList<T, Capacity>::begin() const
+{
+    return const_iterator(fields.head, this);
+}
+
+/**
+ * @brief   Returns a constant iterator to the head of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A constant iterator to the first element, or cend() if the list is empty.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::const_iterator FixedList<T, Capacity>::cbegin() const
+{
+    return const_iterator(fields.head, this);
+}
+
+/**
+ * @brief   Returns an iterator one past the tail of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          An iterator past the last element.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::iterator FixedList<T, Capacity>::end()
+{
+    return iterator(-1, this);
+}
+
+/**
+ * @brief   Returns a constant iterator one past the tail of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A constant iterator past the last element.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::const_iterator FixedList<T, Capacity>::end() const
+{
+    return const_iterator(-1, this);
+}
+
+/**
+ * @brief   Returns a constant iterator one past the tail of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @return          A constant iterator past the last element.
+ */
+template <typename T, int Capacity>
+typename FixedList<T, Capacity>::const_iterator FixedList<T, Capacity>::cend() const
+{
+    return const_iterator(-1, this);
+}
+
+/**
+ * @brief   Constructs an element in a free slot.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the element.
+ * @return          The slot of the new element, or -1 if the list is full.
+ *
+ * @details Reuses the most recently freed slot first, otherwise takes the next slot that was never
+ *          used. The slot is only taken once the element was constructed, so a constructor that
+ *          throws leaves the list as it was. The new slot is not linked into the list yet.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+int FixedList<T, Capacity>::createSlot(Args&&... args)
+{
+    int slot = fields.freeSlot;
+    if(slot == -1)
+    {
+        if(fields.usedSlots == Capacity)    // Every slot holds an element.
+            return -1;
+        slot = fields.usedSlots;
+    }
+    
+    new (fields.slots.elements + slot) T(std::forward<Args>(args)...);
+    if(slot == fields.freeSlot)
+        fields.freeSlot = fields.links.elements[slot].next;
+    else
+        fields.usedSlots++;
+    
+    return slot;
+}
+
+/**
+ * @brief   Destroys the element in a slot and frees the slot.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param slot      The slot to free. It must not be linked into the list anymore.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::destroySlot(const int slot)
+{
+    fields.slots.elements[slot].~T();
+    fields.links.elements[slot].next = fields.freeSlot;
+    fields.freeSlot = slot;
+}
+
+/**
+ * @brief   Links a slot into the list between two neighbouring slots.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param slot      The slot to link.
+ * @param previous  The slot that will come before it, or -1 to make it the head.
+ * @param next      The slot that will come after it, or -1 to make it the tail.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::link(const int slot, const int previous, const int next)
+{
+    fields.links.elements[slot].previous = previous;
+    fields.links.elements[slot].next = next;
+    
+    if(previous == -1)
+        fields.head = slot;
+    else
+        fields.links.elements[previous].next = slot;
+    
+    if(next == -1)
+        fields.tail = slot;
+    else
+        fields.links.elements[next].previous = slot;
+    
+    fields.listSize++;
+}
+
+/**
+ * @brief   Unlinks a slot from the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param slot      The slot to unlink. Its element is not destroyed.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::unlink(const int slot)
+{
+    int previous = fields.links.elements[slot].previous;
+    int next = fields.links.elements[slot].next;
+    
+    if(previous == -1)  // Removing the head of list.
+        fields.head = next;
+    else
+        fields.links.elements[previous].next = next;
+    
+    if(next == -1)      // Removing the tail of list.
+        fields.tail = previous;
+    else
+        fields.links.elements[next].previous = previous;
+    
+    fields.listSize--;
+}
+
+/**
+ * @brief   Returns the slot located at the specified index of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index of the slot. Must be within range of the list.
+ * @return          The slot located at the specified index.
+ *
+ * @details Walks from the head or from the tail, whichever is closer to the index.
+ */
+template <typename T, int Capacity>
+int FixedList<T, Capacity>::slotAt(const int index) const
+{
+    int slot;
+    if(index < fields.listSize/2)
+    {
+        slot = fields.head;
+        for(int i = 0; i < index; i++)
+            slot = fields.links.elements[slot].next;
+    }
+    else
+    {
+        slot = fields.tail;
+        for(int i = fields.listSize-1; i > index; i--)
+            slot = fields.links.elements[slot].previous;
+    }
+    
+    return slot;
+}
+
+/**
+ * @brief   Copies the elements of another list into this list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param copyList  The list whose elements will be copied into this list object.
+ *
+ * @details Assigns to the elements this list already has and only constructs, or destroys,
+ *          the elements that make up the difference in size.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::copyFrom(const FixedList<T, Capacity>& copyList)
+{
+    int slot = fields.head;
+    int copySlot = copyList.fields.head;
+    for(; slot != -1 && copySlot != -1; copySlot = copyList.fields.links.elements[copySlot].next)
+    {
+        fields.slots.elements[slot] = copyList.fields.slots.elements[copySlot];
+        slot = fields.links.elements[slot].next;
+    }
+    
+    // This list was longer, remove the elements past the copied ones.
+    while(fields.listSize > copyList.fields.listSize)
+    {
+        int lastSlot = fields.tail;
+        unlink(lastSlot);
+        destroySlot(lastSlot);
+    }
+    
+    // This list was shorter, append the rest.
+    for(; copySlot != -1; copySlot = copyList.fields.links.elements[copySlot].next)
+        emplaceLast(copyList.fields.slots.elements[copySlot]);
+}
+
+/**
+ * @brief   Moves the elements of another list into this empty list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param other     The list whose elements will be moved. It is empty afterwards.
+ */
+template <typename T, int Capacity>
+void FixedList<T, Capacity>::moveFrom(FixedList<T, Capacity>& other)
+{
+    for(int slot = other.fields.head; slot != -1; slot = other.fields.links.elements[slot].next)
+        emplaceLast(std::move(other.fields.slots.elements[slot]));
+    
+    other.clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Subscript operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param index     Index at which to retrieve data reference from the list.
+ * @return          The reference to the data located at the specified index in the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ *
+ * @details Works the same way that the [] subscript operator does for arrays.
+ */
+template <typename T, int Capacity>
+T& FixedList<T, Capacity>::operator[](const int index)
+{
+    return peek(index);
+}
+
+/**
+ * @brief   Equality comparison operator.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the list can hold.
+ * @param compareList   The linked list object with which to compare this linked list object.
+ * @return              A boolean flag.
+ *
+ * @details Returns true only if the objects are either the same object or both objects
+ *          have the exact same elements in the exact same index locations. If the elements
+ *          are the same but in different index locations, the objects are not considered similar.
+ *          A false flag is returned for all other outcomes.
+ */
+template <typename T, int Capacity>
+bool FixedList<T, Capacity>::operator==(const FixedList& compareList)
+{
+    if(this == &compareList)
+        return true;
+    else if(fields.listSize != compareList.fields.listSize)
+        return false;
+    
+    int slot = fields.head;
+    int compareSlot = compareList.fields.head;
+    while(slot != -1 && compareSlot != -1)
+    {
+        if(fields.slots.elements[slot] != compareList.fields.slots.elements[compareSlot])
+            return false;
+        
+        slot = fields.links.elements[slot].next;
+        compareSlot = compareList.fields.links.elements[compareSlot].next;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param copyList  The linked list object from which to copy elements.
+ * @return          A reference to a copied linked list object.
+ *
+ * @details Assigns to the elements this list already has. If copying an element throws,
+ *          this list is left valid but only partly copied.
+ */
+template <typename T, int Capacity>
+FixedList<T, Capacity>& FixedList<T, Capacity>::operator=(const FixedList& copyList)
+{
+    if(this != &copyList)
+        copyFrom(copyList);
+    
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param moveList  The linked list object from which to move elements.
+ * @return          A reference to a moved linked list object.
+ *
+ * @details Moves linked list elements from the provided list into this linked list object.
+ *          The provided linked list object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, int Capacity>
+FixedList<T, Capacity>& FixedList<T, Capacity>::operator=(FixedList&& moveList) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if(this == &moveList)   // Make sure this and moveList are not the same object.
+        return *this;
+    
+    clear();
+    moveFrom(moveList);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the list can hold.
+ * @param output    The output stream (usually std::cout).
+ * @param list      The linked list object that will be printed.
+ *
+ * @details Prints the list elements to the specified output stream.
+ *
+ * @note    Any class or data type used with this linked list class MUST implement its
+ *          own operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this linked list class NEEDS to implement its own operator<<.
+ */
+template <typename T, int Capacity>
+std::ostream& operator<<(std::ostream& output, const FixedList<T, Capacity>& list)
+{
+    output << "(";
+    for(int slot = list.fields.head; slot != -1; slot = list.fields.links.elements[slot].next)
+    {
+        if(slot != list.fields.head)
+            output << ", ";
+        output << list.fields.slots.elements[slot];
+    }
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* FixedList_hpp */
@@ -0,0 +1,601 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    FixedStack.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic fixed capacity Stack data structure that never allocates.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef FixedStack_hpp
+#define FixedStack_hpp
+
+#include <new>
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+#include "SimdSearch.hpp"
+#include "FixedStorage.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @class   FixedStack
+ * @brief   A generic fixed capacity Stack class.
+ * @details This Stack class is templated to use any data type or class. Every element is stored
+ *          inside the stack object itself, so the stack never allocates, and pushing or popping
+ *          an element takes the same time every time. It has the same interface as Stack, so the
+ *          two can be swapped for one another, except that adding an element to a full stack
+ *          does nothing and returns false instead of growing the stack.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ *
+ * @note    The default constructor is constexpr, so a global stack is constant initialized. With
+ *          trivially destructible elements the stack is trivially destructible, and an empty
+ *          stack can be a constexpr object.
+ */
+template <typename T, int Capacity>
+class FixedStack
+{
+    static_assert(Capacity > 0, "FixedStack needs room for at least one element.");
+    
+public:
+    // ---------- CONSTRUCTORS ----------
+    constexpr FixedStack();
+    template <typename InputIterator>
+    FixedStack(InputIterator first, InputIterator last);
+    FixedStack(std::initializer_list<T> elements);
+    FixedStack(const FixedStack<T, Capacity>& copyStack);
+    FixedStack(FixedStack<T, Capacity>&& moveStack) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----------- FUNCTIONS ------------
+    bool push(const T& data);
+    bool push(T&& data);
+    template <typename... Args>
+    bool emplace(Args&&... args);
+    T pop();
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    constexpr int size() const;
+    constexpr bool empty() const;
+    constexpr bool full() const;
+    static constexpr int capacity();
+    bool contains(const T& element) const;
+    void clear();
+    template <typename InputIterator>
+    bool assign(InputIterator first, InputIterator last);
+    
+    // ----------- OPERATORS ------------
+    bool operator==(const FixedStack& compareStack);
+    FixedStack<T, Capacity>& operator=(const FixedStack& copyStack);
+    FixedStack<T, Capacity>& operator=(FixedStack&& moveStack) noexcept(std::is_nothrow_move_constructible<T>::value);
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, int TypeCapacity>
+    friend std::ostream& operator<<(std::ostream& output, const FixedStack<Type, TypeCapacity>& stack);
+    
+private:
+    /**
+     * @struct  Fields
+     * @brief   The fields of the stack, which FixedFields destroys the elements of.
+     */
+    struct Fields
+    {
+        FixedSlots<T, Capacity> slots;  /**< The elements, from the bottom of the stack to the top. */
+        int stackSize;                  /**< The size of the stack. */
+        
+        /** Default Constructor. */
+        constexpr Fields() : slots(), stackSize(0) {}
+        /** Destroys every element of the stack, from the top to the bottom. */
+        void destroyElements()
+        {
+            for(int i = stackSize-1; i >= 0; i--)
+                slots.elements[i].~T();
+        }
+    };
+    
+    // ------------- FIELDS -------------
+    FixedFields<Fields, std::is_trivially_destructible<T>::value> fields;   /**< The elements and the size of the stack. */
+    
+    // ----------- FUNCTIONS ------------
+    void copyFrom(const FixedStack<T, Capacity>& copyStack);
+    void moveFrom(FixedStack<T, Capacity>& other);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ *
+ * @details Initializes this stack object with a size of 0, without constructing any element.
+ */
+template <typename T, int Capacity>
+constexpr FixedStack<T, Capacity>::FixedStack() : fields() {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam Capacity         The number of elements the stack can hold.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range, which becomes the bottom of the stack.
+ * @param last              One past the last element of the range, which becomes the top of the stack.
+ *
+ * @note    Only the first Capacity elements of the range are pushed, check size() to find out if that
+ *          was all of them.
+ */
+template <typename T, int Capacity>
+template <typename InputIterator>
+FixedStack<T, Capacity>::FixedStack(InputIterator first, InputIterator last) : FixedStack()
+{
+    assign(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param elements  The elements of the stack, from the bottom to the top.
+ *
+ * @note    Only the first Capacity elements are pushed.
+ */
+template <typename T, int Capacity>
+FixedStack<T, Capacity>::FixedStack(std::initializer_list<T> elements) : FixedStack()
+{
+    assign(elements.begin(), elements.end());
+}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param copyStack     The stack whose elements will be copied into this stack object.
+ */
+template <typename T, int Capacity>
+FixedStack<T, Capacity>::FixedStack(const FixedStack<T, Capacity>& copyStack) : FixedStack()
+{
+    copyFrom(copyStack);
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param moveStack     The stack whose elements will be moved into this stack object.
+ *
+ * @details The elements live inside the stack objects, so they are moved one by one.
+ *          The provided stack object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, int Capacity>
+FixedStack<T, Capacity>::FixedStack(FixedStack<T, Capacity>&& moveStack) noexcept(std::is_nothrow_move_constructible<T>::value) : FixedStack()
+{
+    moveFrom(moveStack);
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds element to the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param data      The element you want to add to the stack.
+ * @return          True if the element was added, false if the stack is full.
+ */
+template <typename T, int Capacity>
+bool FixedStack<T, Capacity>::push(const T& data)
+{
+    return emplace(data);
+}
+
+/**
+ * @brief   Moves element to the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param data      The element you want to move into the stack.
+ * @return          True if the element was added, false if the stack is full.
+ *
+ * @details The element is left untouched if the stack is full.
+ */
+template <typename T, int Capacity>
+bool FixedStack<T, Capacity>::push(T&& data)
+{
+    return emplace(std::move(data));
+}
+
+/**
+ * @brief   Constructs element in place at the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @tparam Args     The types of the constructor arguments.
+ * @param args      The arguments forwarded to the constructor of the element.
+ * @return          True if the element was added, false if the stack is full.
+ *
+ * @details No element is constructed if the stack is full.
+ */
+template <typename T, int Capacity>
+template <typename... Args>
+bool FixedStack<T, Capacity>::emplace(Args&&... args)
+{
+    if(fields.stackSize == Capacity)
+        return false;
+    
+    new (fields.slots.elements + fields.stackSize) T(std::forward<Args>(args)...);
+    fields.stackSize++;
+    return true;
+}
+
+/**
+ * @brief   Removes and returns the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          The removed element.
+ *
+ * @details The element is moved out of the stack, not copied.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int Capacity>
+T FixedStack<T, Capacity>::pop()
+{
+    if(fields.stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    T& top = fields.slots.elements[fields.stackSize-1];
+    T popped_data = std::move(top);
+    top.~T();
+    fields.stackSize--;
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes the top of the stack and moves it into the provided variable.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param out       The variable that receives the removed element.
+ * @return          True if an element was removed, false if the stack is empty.
+ *
+ * @details Works like pop() but reports an empty stack through the return value instead of throwing.
+ */
+template <typename T, int Capacity>
+bool FixedStack<T, Capacity>::tryPop(T& out)
+{
+    if(fields.stackSize == 0)
+        return false;
+    
+    T& top = fields.slots.elements[fields.stackSize-1];
+    out = std::move(top);
+    top.~T();
+    fields.stackSize--;
+    
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          A reference to the element located at the top of the stack.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int Capacity>
+T& FixedStack<T, Capacity>::peek()
+{
+    if(fields.stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    return fields.slots.elements[fields.stackSize-1];
+}
+
+/**
+ * @brief   Returns, but does not remove, the top of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          A constant reference to the element located at the top of the stack.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T, int Capacity>
+const T& FixedStack<T, Capacity>::peek() const
+{
+    if(fields.stackSize == 0)
+        throw std::underflow_error("Stack is Empty");
+    
+    return fields.slots.elements[fields.stackSize-1];
+}
+
+/**
+ * @brief   Returns the size of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          The size of the stack.
+ */
+template <typename T, int Capacity>
+constexpr int FixedStack<T, Capacity>::size() const
+{
+    return fields.stackSize;
+}
+
+/**
+ * @brief   Returns true if the stack is empty and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedStack<T, Capacity>::empty() const
+{
+    return fields.stackSize == 0;
+}
+
+/**
+ * @brief   Returns true if the stack is full and false otherwise.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          A boolean flag.
+ */
+template <typename T, int Capacity>
+constexpr bool FixedStack<T, Capacity>::full() const
+{
+    return fields.stackSize == Capacity;
+}
+
+/**
+ * @brief   Returns the number of elements the stack can hold.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @return          The capacity of the stack.
+ */
+template <typename T, int Capacity>
+constexpr int FixedStack<T, Capacity>::capacity()
+{
+    return Capacity;
+}
+
+/**
+ * @brief   Checks if an element is in the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param element   The element being searched for in the stack.
+ * @return          A boolean flag.
+ *
+ * @details The elements are contiguous, so integer and floating point elements are
+ *          searched with the vectorized kernels from SimdSearch.
+ */
+template <typename T, int Capacity>
+bool FixedStack<T, Capacity>::contains(const T& element) const
+{
+    return SimdSearch::find(fields.slots.elements, fields.stackSize, element) != -1;
+}
+
+/**
+ * @brief   Destroys every element of the stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ */
+template <typename T, int Capacity>
+void FixedStack<T, Capacity>::clear()
+{
+    fields.destroyElements();
+    fields.stackSize = 0;
+}
+
+/**
+ * @brief   Replaces the elements of the stack with the elements of a range.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam Capacity         The number of elements the stack can hold.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range, which becomes the bottom of the stack.
+ * @param last              One past the last element of the range, which becomes the top of the stack.
+ * @return                  True if every element of the range was pushed, false if the stack filled up first.
+ *
+ * @details The stack is cleared first. If the range does not fit, the stack holds its first Capacity elements.
+ */
+template <typename T, int Capacity>
+template <typename InputIterator>
+bool FixedStack<T, Capacity>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    for(; first != last; ++first)
+        if(!emplace(*first))
+            return false;
+    
+    return true;
+}
+
+/**
+ * @brief   Copies the elements of another stack into this stack.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param copyStack     The stack whose elements will be copied into this stack object.
+ *
+ * @details Assigns to the elements this stack already has and only constructs, or destroys,
+ *          the elements that make up the difference in size.
+ */
+template <typename T, int Capacity>
+void FixedStack<T, Capacity>::copyFrom(const FixedStack<T, Capacity>& copyStack)
+{
+    while(fields.stackSize > copyStack.fields.stackSize)
+        fields.slots.elements[--fields.stackSize].~T();
+    
+    for(int i = 0; i < fields.stackSize; i++)
+        fields.slots.elements[i] = copyStack.fields.slots.elements[i];
+    
+    while(fields.stackSize < copyStack.fields.stackSize)
+    {
+        new (fields.slots.elements + fields.stackSize) T(copyStack.fields.slots.elements[fields.stackSize]);
+        fields.stackSize++;
+    }
+}
+
+/**
+ * @brief   Moves the elements of another stack into this empty stack.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param other     The stack whose elements will be moved. It is empty afterwards.
+ */
+template <typename T, int Capacity>
+void FixedStack<T, Capacity>::moveFrom(FixedStack<T, Capacity>& other)
+{
+    for(int i = 0; i < other.fields.stackSize; i++)
+    {
+        new (fields.slots.elements + i) T(std::move(other.fields.slots.elements[i]));
+        fields.stackSize++;
+    }
+    
+    other.clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Compares this stack object with another stack object.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param compareStack  The stack object with which to compare this stack object.
+ * @return              A boolean flag.
+ *
+ * @details Returns true only if the objects are either the same object or both objects
+ *          have the exact same elements in the exact same order.
+ */
+template <typename T, int Capacity>
+bool FixedStack<T, Capacity>::operator==(const FixedStack& compareStack)
+{
+    if(this == &compareStack)
+        return true;
+    else if(fields.stackSize != compareStack.fields.stackSize)
+        return false;
+    
+    return SimdSearch::equal(fields.slots.elements, compareStack.fields.slots.elements, fields.stackSize);
+}
+
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param copyStack     The stack object from which to copy elements.
+ * @return              A reference to a copied stack object.
+ *
+ * @details Assigns to the elements this stack already has. If copying an element throws,
+ *          this stack is left valid but only partly copied.
+ */
+template <typename T, int Capacity>
+FixedStack<T, Capacity>& FixedStack<T, Capacity>::operator=(const FixedStack& copyStack)
+{
+    if(this != &copyStack)
+        copyFrom(copyStack);
+    
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Capacity     The number of elements the stack can hold.
+ * @param moveStack     The stack object from which to move elements.
+ * @return              A reference to a moved stack object.
+ *
+ * @details Moves stack elements from the provided stack into this stack object.
+ *          The provided stack object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, int Capacity>
+FixedStack<T, Capacity>& FixedStack<T, Capacity>::operator=(FixedStack&& moveStack) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if(this == &moveStack)  // Make sure this and moveStack are not the same object.
+        return *this;
+    
+    clear();
+    moveFrom(moveStack);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements the stack can hold.
+ * @param output    The output stream (usually std::cout).
+ * @param stack     The stack object that will be printed.
+ *
+ * @details Prints the stack elements to the specified output stream. Prints starting from the
+ *          bottom of the stack and finishes printing at the top of the stack (BOTTOM, ... , TOP).
+ *
+ * @note    Any class or data type used with this stack class MUST implement its
+ *          own operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this stack class NEEDS to implement its own operator<<.
+ */
+template <typename T, int Capacity>
+std::ostream& operator<<(std::ostream& output, const FixedStack<T, Capacity>& stack)
+{
+    output << "(";
+    for(int i = 0; i < stack.fields.stackSize; i++)
+    {
+        if(i > 0)
+            output << ", ";
+        output << stack.fields.slots.elements[i];
+    }
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* FixedStack_hpp */
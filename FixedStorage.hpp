@@ -0,0 +1,99 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    FixedStorage.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The inline element storage that every fixed capacity data structure keeps its elements in.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef FixedStorage_hpp
+#define FixedStorage_hpp
+
+#include <type_traits>
+
+namespace DataStructures
+{
+
+/**
+ * @union   FixedSlots
+ * @brief   Room for a fixed number of elements, without constructing any of them.
+ * @details The elements are constructed with placement new and destroyed by the data structure that
+ *          owns the slots, which is the only one that knows which slots are in use. Constructing the
+ *          slots only initializes a single byte, so they can be constant initialized, and they are
+ *          trivially destructible whenever the elements are.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements that fit into the slots.
+ * @tparam Trivial  True if the elements are trivially destructible.
+ */
+template <typename T, int Capacity, bool Trivial = std::is_trivially_destructible<T>::value>
+union FixedSlots
+{
+    char unused;            /**< The active member until the first element is constructed. */
+    T elements[Capacity];   /**< The elements. Only the slots in use hold a constructed element. */
+    
+    /** Default Constructor. Constructs none of the elements. */
+    constexpr FixedSlots() : unused() {}
+};
+
+/**
+ * @union   FixedSlots
+ * @brief   Room for a fixed number of elements that are not trivially destructible.
+ * @details See FixedSlots. The destructor does nothing, the owner destroys the elements in use.
+ * @tparam T        Any data type or class.
+ * @tparam Capacity The number of elements that fit into the slots.
+ */
+template <typename T, int Capacity>
+union FixedSlots<T, Capacity, false>
+{
+    char unused;            /**< The active member until the first element is constructed. */
+    T elements[Capacity];   /**< The elements. Only the slots in use hold a constructed element. */
+    
+    /** Default Constructor. Constructs none of the elements. */
+    constexpr FixedSlots() : unused() {}
+    /** Class Destructor. Destroys none of the elements. */
+    ~FixedSlots() {}
+};
+
+/**
+ * @class   FixedFields
+ * @brief   The fields of a fixed capacity data structure, with trivially destructible elements.
+ * @details A fixed capacity data structure keeps all of its fields in one struct and holds it
+ *          through FixedFields, so it needs no destructor of its own. With trivially destructible
+ *          elements nothing has to be destroyed, the data structure stays trivially destructible,
+ *          and an empty one can be a constexpr object.
+ * @tparam Fields   The fields of the data structure, with a constexpr default constructor and
+ *                  a destroyElements() function that destroys the elements in use.
+ * @tparam Trivial  True if the elements are trivially destructible.
+ */
+template <typename Fields, bool Trivial>
+class FixedFields : public Fields
+{
+public:
+    /** Default Constructor. */
+    constexpr FixedFields() : Fields() {}
+};
+
+/**
+ * @class   FixedFields
+ * @brief   The fields of a fixed capacity data structure, with elements that need to be destroyed.
+ * @details See FixedFields. Destroys the elements in use when the data structure is destroyed.
+ * @tparam Fields   The fields of the data structure.
+ */
+template <typename Fields>
+class FixedFields<Fields, false> : public Fields
+{
+public:
+    /** Default Constructor. */
+    constexpr FixedFields() : Fields() {}
+    /** Class Destructor. Destroys the elements in use. */
+    ~FixedFields() { Fields::destroyElements(); }
+};
+
+} // namespace DataStructures
+
+#endif /* FixedStorage_hpp */
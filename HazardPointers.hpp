@@ -0,0 +1,312 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    HazardPointers.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   Hazard pointer based memory reclamation for the lock-free data structures.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef HazardPointers_hpp
+#define HazardPointers_hpp
+
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+namespace DataStructures
+{
+
+/**
+ * @class   HazardPointers
+ * @brief   Safe memory reclamation for nodes that other threads may still be reading.
+ * @details Every thread owns a few hazard slots. Before a thread reads a node it got from a
+ *          shared atomic pointer, it publishes the node in one of its slots with protect().
+ *          A node that was unlinked from its data structure is handed to retire() instead of
+ *          being deleted, and it is only deleted once no slot of any thread holds it anymore.
+ *          A node that is protected can therefore never be deleted and its address can never
+ *          be reused, which also rules out the ABA problem for compare-and-swap loops.
+ *
+ * @note    The nodes handed to retire() must have been allocated with new.
+ */
+class HazardPointers
+{
+public:
+    // ----------- CONSTANTS ------------
+    static const int SLOTS_PER_THREAD = 2;  /**< Number of nodes a thread can protect at the same time. */
+    
+    // ----------- FUNCTIONS ------------
+    template <typename NodeType>
+    static NodeType* protect(const int slot, const std::atomic<NodeType*>& source);
+    static void clear(const int slot);
+    template <typename NodeType>
+    static void retire(NodeType* node);
+    
+private:
+    /**
+     * @struct  Retired
+     * @brief   A node waiting to be deleted, and the function that deletes it.
+     */
+    struct Retired
+    {
+        void* node;                 /**< The retired node. */
+        void (*destroy)(void*);     /**< Deletes the node with the right type. */
+    };
+    
+    /**
+     * @struct  Record
+     * @brief   The hazard slots and retired nodes of one thread.
+     * @details Records are never deleted while the program runs. When a thread exits its record
+     *          is released, and the next thread that starts using hazard pointers takes it over
+     *          together with all the nodes in it that could not be deleted yet.
+     */
+    struct Record
+    {
+        std::atomic<const void*> hazards[SLOTS_PER_THREAD]; /**< The nodes this thread is reading. */
+        std::atomic<bool> active;   /**< True while a thread owns this record. */
+        Record* next;               /**< The next record of the domain. */
+        std::vector<Retired> retired;   /**< Nodes retired by the owning thread. Only the owner touches them. */
+        
+        /** Default Constructor. */
+        Record() : active(true), next(nullptr)
+        {
+            for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+                hazards[slot].store(nullptr, std::memory_order_relaxed);
+        }
+    };
+    
+    /**
+     * @struct  Domain
+     * @brief   Every record that was ever created.
+     */
+    struct Domain
+    {
+        std::atomic<Record*> records;   /**< The most recently created record. */
+        std::atomic<int> recordCount;   /**< The number of records. */
+        
+        /** Default Constructor. */
+        Domain() : records(nullptr), recordCount(0) {}
+        ~Domain();
+    };
+    
+    /**
+     * @struct  Owner
+     * @brief   Holds the record of the current thread and releases it when the thread exits.
+     */
+    struct Owner
+    {
+        Record* record; /**< The record owned by the current thread. */
+        
+        Owner();
+        ~Owner();
+    };
+    
+    // ----------- CONSTANTS ------------
+    static const int MINIMUM_SCAN_THRESHOLD = 64;   /**< The fewest retired nodes that trigger a scan. */
+    
+    // ----------- FUNCTIONS ------------
+    static Domain& domain();
+    static Record& ownRecord();
+    static void scan(Record& record);
+    template <typename NodeType>
+    static void destroyNode(void* node);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Loads a shared pointer and protects the node it points to.
+ *
+ * @tparam NodeType The node type.
+ * @param slot      The hazard slot of the current thread to use, from 0 to SLOTS_PER_THREAD-1.
+ * @param source    The shared pointer to load.
+ * @return          The protected node, which is not deleted until the slot is cleared or reused.
+ *
+ * @details The pointer is loaded again after the node was published, which proves that the
+ *          node was still linked into the data structure after the slot was visible to other threads.
+ */
+template <typename NodeType>
+NodeType* HazardPointers::protect(const int slot, const std::atomic<NodeType*>& source)
+{
+    std::atomic<const void*>& hazard = ownRecord().hazards[slot];
+    NodeType* node = source.load(std::memory_order_relaxed);
+    while(true)
+    {
+        hazard.store(node, std::memory_order_seq_cst);
+        NodeType* current = source.load(std::memory_order_seq_cst);
+        if(current == node)
+            return node;
+        node = current;
+    }
+}
+
+/**
+ * @brief   Stops protecting the node in a hazard slot of the current thread.
+ *
+ * @param slot  The hazard slot to clear.
+ */
+inline void HazardPointers::clear(const int slot)
+{
+    ownRecord().hazards[slot].store(nullptr, std::memory_order_release);
+}
+
+/**
+ * @brief   Deletes a node as soon as no thread is reading it anymore.
+ *
+ * @tparam NodeType The node type.
+ * @param node      A node that was allocated with new and is no longer linked into its data structure.
+ *
+ * @details The retired nodes of a thread are collected and checked against all hazard
+ *          slots in one go, once there are a few times more of them than there are slots.
+ *          This keeps the cost of retiring a node constant on average.
+ */
+template <typename NodeType>
+void HazardPointers::retire(NodeType* node)
+{
+    Record& record = ownRecord();
+    Retired retiredNode = {node, &HazardPointers::destroyNode<NodeType>};
+    record.retired.push_back(retiredNode);
+    
+    int threshold = 2 * SLOTS_PER_THREAD * domain().recordCount.load(std::memory_order_relaxed);
+    if((int)record.retired.size() >= std::max(threshold, (int)MINIMUM_SCAN_THRESHOLD))
+        scan(record);
+}
+
+/**
+ * @brief   Returns the domain that holds every record.
+ *
+ * @return  The domain.
+ */
+inline HazardPointers::Domain& HazardPointers::domain()
+{
+    static Domain instance;
+    return instance;
+}
+
+/**
+ * @brief   Returns the record of the current thread.
+ *
+ * @return  The record.
+ */
+inline HazardPointers::Record& HazardPointers::ownRecord()
+{
+    thread_local Owner owner;
+    return *owner.record;
+}
+
+/**
+ * @brief   Deletes every retired node of a record that is not protected by any thread.
+ *
+ * @param record    The record whose retired nodes are checked.
+ */
+inline void HazardPointers::scan(Record& record)
+{
+    std::vector<const void*> protectedNodes;
+    for(Record* current = domain().records.load(std::memory_order_acquire); current != nullptr; current = current->next)
+        for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+        {
+            const void* node = current->hazards[slot].load(std::memory_order_seq_cst);
+            if(node != nullptr)
+                protectedNodes.push_back(node);
+        }
+    std::sort(protectedNodes.begin(), protectedNodes.end());
+    
+    std::vector<Retired> stillProtected;
+    for(const Retired& retiredNode : record.retired)
+    {
+        if(std::binary_search(protectedNodes.begin(), protectedNodes.end(), (const void*)retiredNode.node))
+            stillProtected.push_back(retiredNode);
+        else
+            retiredNode.destroy(retiredNode.node);
+    }
+    record.retired.swap(stillProtected);
+}
+
+/**
+ * @brief   Deletes a node with its own type.
+ *
+ * @tparam NodeType The node type.
+ * @param node      The node to delete.
+ */
+template <typename NodeType>
+void HazardPointers::destroyNode(void* node)
+{
+    delete static_cast<NodeType*>(node);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @details Runs when the program exits, after every thread stopped using hazard pointers,
+ *          so every node that is still retired can be deleted.
+ */
+inline HazardPointers::Domain::~Domain()
+{
+    Record* record = records.load(std::memory_order_acquire);
+    while(record != nullptr)
+    {
+        for(const Retired& retiredNode : record->retired)
+            retiredNode.destroy(retiredNode.node);
+        
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+/**
+ * @brief   Default Constructor.
+ *
+ * @details Takes over a released record if there is one, otherwise adds a new record to the domain.
+ */
+inline HazardPointers::Owner::Owner() : record(nullptr)
+{
+    Domain& hazardDomain = domain();
+    for(Record* current = hazardDomain.records.load(std::memory_order_acquire); current != nullptr; current = current->next)
+    {
+        bool released = false;
+        if(current->active.compare_exchange_strong(released, true, std::memory_order_acquire))
+        {
+            record = current;
+            return;
+        }
+    }
+    
+    record = new Record();
+    Record* head = hazardDomain.records.load(std::memory_order_relaxed);
+    do
+        record->next = head;
+    while(!hazardDomain.records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    hazardDomain.recordCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @details Runs when the thread exits. Deletes every retired node that it can and releases
+ *          the record, so the remaining nodes are handled by the next owner of the record.
+ */
+inline HazardPointers::Owner::~Owner()
+{
+    for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+        record->hazards[slot].store(nullptr, std::memory_order_release);
+    
+    scan(*record);
+    record->active.store(false, std::memory_order_release);
+}
+
+} // namespace DataStructures
+
+#endif /* HazardPointers_hpp */
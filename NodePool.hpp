@@ -0,0 +1,428 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    NodePool.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A slab based free-list allocator for the nodes of the node based data structures.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef NodePool_hpp
+#define NodePool_hpp
+
+#include <new>
+#include <memory>
+#include <utility>
+#include <iterator>
+
+namespace DataStructures
+{
+
+/**
+ * @struct  EmplaceTag
+ * @brief   Selects the node constructor that builds the stored data in place from its constructor arguments.
+ */
+struct EmplaceTag {};
+
+/**
+ * @brief   Returns the number of elements in a range of forward iterators.
+ *
+ * @tparam Iterator A forward iterator.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ * @return          The number of elements in the range.
+ */
+template <typename Iterator>
+int rangeSize(Iterator first, Iterator last, std::forward_iterator_tag)
+{
+    return (int)std::distance(first, last);
+}
+
+/**
+ * @brief   Returns 0 for a range of input iterators, which can only be walked once.
+ *
+ * @tparam Iterator An input iterator.
+ * @return          Always 0, the size of the range is not known up front.
+ */
+template <typename Iterator>
+int rangeSize(Iterator, Iterator, std::input_iterator_tag)
+{
+    return 0;
+}
+
+/**
+ * @brief   Returns the number of elements in a range if it can be counted without consuming it.
+ *
+ * @tparam Iterator Any iterator.
+ * @param first     The first element of the range.
+ * @param last      One past the last element of the range.
+ * @return          The number of elements in the range, or 0 for a range of input iterators.
+ *
+ * @details Used by the bulk constructors to reserve every node of a range with one allocation.
+ */
+template <typename Iterator>
+int rangeSize(Iterator first, Iterator last)
+{
+    return rangeSize(first, last, typename std::iterator_traits<Iterator>::iterator_category());
+}
+
+/**
+ * @class   NodePool
+ * @brief   A generic slab/free-list node pool.
+ * @details Memory is requested from the allocator in slabs that hold many nodes at once. Destroyed
+ *          nodes are kept on a free list and recycled by the next create() call, so a container
+ *          that keeps adding and removing elements stops calling malloc/free altogether.
+ *          All slabs can be released at once with release().
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ *
+ * @note    A NodePool is not thread safe. A pool can be shared by several containers as long
+ *          as they are all used from the same thread.
+ */
+template <typename NodeType, typename Allocator = std::allocator<NodeType>>
+class NodePool
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    NodePool();
+    explicit NodePool(const Allocator& allocator);
+    NodePool(const NodePool<NodeType, Allocator>& copyPool) = delete;
+    ~NodePool();
+    
+    // ----------- FUNCTIONS ------------
+    template <typename... Args>
+    NodeType* create(Args&&... args);
+    void destroy(NodeType* node);
+    void reserve(const int count);
+    void release();
+    bool absorb(NodePool<NodeType, Allocator>& other);
+    int slabs();
+    
+    // ----------- OPERATORS ------------
+    NodePool<NodeType, Allocator>& operator=(const NodePool<NodeType, Allocator>& copyPool) = delete;
+    
+private:
+    /**
+     * @union   Slot
+     * @brief   Storage for a single node, or a link to the next free slot while the slot is unused.
+     */
+    union Slot
+    {
+        Slot* nextFree;                                         /**< The next free slot (or previous slab). */
+        alignas(NodeType) unsigned char storage[sizeof(NodeType)];  /**< Raw storage for one node. */
+    };
+    
+    /**
+     * @struct  SlabHeader
+     * @brief   Stored in the first slots of every slab.
+     */
+    struct SlabHeader
+    {
+        SlabHeader* previous;   /**< The previous slab. */
+        int slotCount;          /**< The number of slots in the slab, including the header slots. */
+    };
+    
+    // ------------- TYPES --------------
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Slot> SlabAllocator;
+    typedef std::allocator_traits<SlabAllocator> SlabTraits;
+    
+    // ------------- FIELDS -------------
+    SlabAllocator slabAllocator;    /**< Requests and frees the slabs. */
+    Slot* freeList;     /**< Slots that were used and then destroyed. */
+    SlabHeader* slabList;   /**< The most recent slab. Every slab links to the previous slab. */
+    Slot* bumpNext;     /**< The next never used slot in the most recent slab. */
+    Slot* bumpEnd;      /**< One past the last slot in the most recent slab. */
+    int slabCapacity;   /**< Number of slots that will be requested for the next slab. */
+    int slabTotal;      /**< Number of slabs currently held by the pool. */
+    
+    // ----------- CONSTANTS ------------
+    static const int INITIAL_SLAB_CAPACITY = 16;    /**< Slots in the first slab. */
+    static const int MAXIMUM_SLAB_CAPACITY = 4096;  /**< Slab sizes double until they reach this size. */
+    static const int HEADER_SLOTS = (sizeof(SlabHeader) + sizeof(Slot) - 1) / sizeof(Slot);    /**< Slots taken by the header of a slab. */
+    
+    // ----------- FUNCTIONS ------------
+    Slot* allocateSlot();
+    void allocateSlab(const int capacity);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ *
+ * @details Initializes an empty pool. No memory is requested until the first node is created.
+ */
+template <typename NodeType, typename Allocator>
+NodePool<NodeType, Allocator>::NodePool() : NodePool(Allocator()) {}
+
+/**
+ * @brief   Allocator Constructor.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @param allocator     The allocator this pool will request its slabs from.
+ *
+ * @details Initializes an empty pool. No memory is requested until the first node is created.
+ */
+template <typename NodeType, typename Allocator>
+NodePool<NodeType, Allocator>::NodePool(const Allocator& allocator) : slabAllocator(allocator), freeList(nullptr), slabList(nullptr), bumpNext(nullptr), bumpEnd(nullptr),
+                                                                      slabCapacity(INITIAL_SLAB_CAPACITY), slabTotal(0) {}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ *
+ * @details Releases every slab using the release() function.
+ *
+ * @warning Node destructors are NOT called. Destroy the nodes that are still in use before the pool goes away.
+ */
+template <typename NodeType, typename Allocator>
+NodePool<NodeType, Allocator>::~NodePool()
+{
+    release();
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Creates a new node inside the pool.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @tparam Args     The types of the node constructor arguments.
+ * @param args      The arguments forwarded to the node constructor.
+ * @return          A pointer to the newly created node.
+ *
+ * @details Recycles a previously destroyed slot when one is available, otherwise takes the next
+ *          slot of the most recent slab, and only requests a new slab when that one is full.
+ */
+template <typename NodeType, typename Allocator>
+template <typename... Args>
+NodeType* NodePool<NodeType, Allocator>::create(Args&&... args)
+{
+    Slot* slot = allocateSlot();
+    try
+    {
+        return new (slot->storage) NodeType(std::forward<Args>(args)...);
+    }
+    catch(...)  // Give the slot back if the node constructor throws.
+    {
+        slot->nextFree = freeList;
+        freeList = slot;
+        throw;
+    }
+}
+
+/**
+ * @brief   Destroys a node and recycles its memory.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @param node      The node to destroy. It must have been created by this pool.
+ */
+template <typename NodeType, typename Allocator>
+void NodePool<NodeType, Allocator>::destroy(NodeType* node)
+{
+    node->~NodeType();
+    
+    Slot* slot = reinterpret_cast<Slot*>(node);
+    slot->nextFree = freeList;
+    freeList = slot;
+}
+
+/**
+ * @brief   Makes sure that the next nodes can be created without requesting memory.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @param count     The number of nodes that will be created.
+ *
+ * @details Requests at most one slab, big enough for all the nodes that do not fit into
+ *          the unused part of the most recent slab. Slots on the free list are not counted,
+ *          so they are simply used first.
+ */
+template <typename NodeType, typename Allocator>
+void NodePool<NodeType, Allocator>::reserve(const int count)
+{
+    int available = (int)(bumpEnd - bumpNext);
+    if(count > available)
+        allocateSlab(count - available);   // The unused slots are moved to the free list and used first.
+}
+
+/**
+ * @brief   Releases every slab at once and resets the pool to its default state.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ *
+ * @warning Node destructors are NOT called. Any node still in use becomes invalid.
+ */
+template <typename NodeType, typename Allocator>
+void NodePool<NodeType, Allocator>::release()
+{
+    while(slabList != nullptr)
+    {
+        SlabHeader* previousSlab = slabList->previous;
+        SlabTraits::deallocate(slabAllocator, reinterpret_cast<Slot*>(slabList), slabList->slotCount);
+        slabList = previousSlab;
+    }
+    
+    freeList = nullptr;
+    bumpNext = nullptr;
+    bumpEnd = nullptr;
+    slabCapacity = INITIAL_SLAB_CAPACITY;
+    slabTotal = 0;
+}
+
+/**
+ * @brief   Takes over every slab of another pool.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @param other         The pool whose slabs will be moved into this pool.
+ * @return              True if the slabs were moved, false if the two pools use allocators
+ *                      that cannot free each other's memory.
+ *
+ * @details The nodes that are alive in the other pool now belong to this pool and must be
+ *          destroyed through it. Nothing is allocated and no node is moved. The other pool
+ *          is empty afterwards.
+ *
+ * @note    The unused tail of the most recent slab of the other pool is only kept when this
+ *          pool has no unused slab space of its own. Otherwise it is freed by release().
+ */
+template <typename NodeType, typename Allocator>
+bool NodePool<NodeType, Allocator>::absorb(NodePool<NodeType, Allocator>& other)
+{
+    if(!(slabAllocator == other.slabAllocator))
+        return false;
+    else if(this == &other || other.slabList == nullptr)
+        return true;
+    
+    // Put the slabs of the other pool in front of the slabs of this pool.
+    SlabHeader* oldestSlab = other.slabList;
+    while(oldestSlab->previous != nullptr)
+        oldestSlab = oldestSlab->previous;
+    oldestSlab->previous = slabList;
+    slabList = other.slabList;
+    
+    // Append the free list of this pool to the free list of the other pool.
+    if(other.freeList != nullptr)
+    {
+        Slot* lastFree = other.freeList;
+        while(lastFree->nextFree != nullptr)
+            lastFree = lastFree->nextFree;
+        lastFree->nextFree = freeList;
+        freeList = other.freeList;
+    }
+    
+    if(bumpNext == bumpEnd)
+    {
+        bumpNext = other.bumpNext;
+        bumpEnd = other.bumpEnd;
+    }
+    
+    if(slabCapacity < other.slabCapacity)
+        slabCapacity = other.slabCapacity;
+    slabTotal += other.slabTotal;
+    
+    other.freeList = nullptr;
+    other.slabList = nullptr;
+    other.bumpNext = nullptr;
+    other.bumpEnd = nullptr;
+    other.slabCapacity = INITIAL_SLAB_CAPACITY;
+    other.slabTotal = 0;
+    return true;
+}
+
+/**
+ * @brief   Returns the number of slabs currently held by the pool.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @return          The number of slabs.
+ */
+template <typename NodeType, typename Allocator>
+int NodePool<NodeType, Allocator>::slabs()
+{
+    return slabTotal;
+}
+
+/**
+ * @brief   Returns an unused slot, requesting a new slab if needed.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @return          A pointer to the unused slot.
+ */
+template <typename NodeType, typename Allocator>
+typename NodePool<NodeType, Allocator>::Slot* NodePool<NodeType, Allocator>::allocateSlot()
+{
+    if(freeList != nullptr)     // Recycle a destroyed node first.
+    {
+        Slot* slot = freeList;
+        freeList = freeList->nextFree;
+        return slot;
+    }
+    
+    if(bumpNext == bumpEnd)     // Most recent slab is full, request a new one.
+    {
+        allocateSlab(slabCapacity);
+        if(slabCapacity < MAXIMUM_SLAB_CAPACITY)
+            slabCapacity *= 2;
+    }
+    
+    return bumpNext++;
+}
+
+/**
+ * @brief   Requests a new slab and makes it the most recent slab.
+ *
+ * @tparam NodeType     The node type that will be allocated from this pool.
+ * @tparam Allocator    The allocator the slabs are requested from.
+ * @param capacity  The number of slots in the new slab.
+ *
+ * @details The unused slots of the previous most recent slab are moved to the free list first,
+ *          so none of them are lost.
+ */
+template <typename NodeType, typename Allocator>
+void NodePool<NodeType, Allocator>::allocateSlab(const int capacity)
+{
+    while(bumpNext != bumpEnd)
+    {
+        bumpNext->nextFree = freeList;
+        freeList = bumpNext++;
+    }
+    
+    // The first slots of the slab are reserved for the header that links the slab to the previous slab.
+    Slot* slab = SlabTraits::allocate(slabAllocator, capacity + HEADER_SLOTS);
+    SlabHeader* header = reinterpret_cast<SlabHeader*>(slab);
+    header->previous = slabList;
+    header->slotCount = capacity + HEADER_SLOTS;
+    slabList = header;
+    bumpNext = slab + HEADER_SLOTS;
+    bumpEnd = slab + HEADER_SLOTS + capacity;
+    slabTotal++;
+}
+
+} // namespace DataStructures
+
+#endif /* NodePool_hpp */
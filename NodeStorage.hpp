@@ -0,0 +1,363 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    NodeStorage.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The node storage that every node based data structure allocates its nodes from.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef NodeStorage_hpp
+#define NodeStorage_hpp
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include "NodePool.hpp"
+#if defined(DATASTRUCTURES_STATS)
+    #include "ContainerStats.hpp"
+#endif
+
+namespace DataStructures
+{
+
+/**
+ * @class   NodeStorage
+ * @brief   Owns the share of a NodePool that a single data structure allocates its nodes from.
+ * @details Creates the pool the first time a node is needed, shares it with other data structures,
+ *          reserves nodes for bulk construction, and tears a whole chain or tree of nodes down
+ *          without recursion. When nothing else shares the pool, a teardown releases every slab at
+ *          once and skips the walk entirely if the nodes are trivially destructible.
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ *
+ *          When DATASTRUCTURES_STATS is defined, the storage also keeps the ContainerStats of its
+ *          data structure and counts every node it allocates and frees.
+ *
+ * @note    A NodeStorage is not thread safe, just like the NodePool it uses.
+ */
+template <typename NodeType, typename Allocator = std::allocator<NodeType>>
+class NodeStorage
+{
+public:
+    // ---------- CONSTRUCTORS ----------
+    NodeStorage();
+    explicit NodeStorage(const Allocator& allocator);
+    explicit NodeStorage(const std::shared_ptr<NodePool<NodeType, Allocator>>& sharedPool);
+    NodeStorage(const NodeStorage<NodeType, Allocator>& copyStorage) = delete;
+    
+    // ----------- FUNCTIONS ------------
+    template <typename... Args>
+    NodeType* create(Args&&... args);
+    void destroy(NodeType* node);
+    void reserve(const int count);
+    void destroyChain(NodeType* first, NodeType* NodeType::*link, const bool trivial = std::is_trivially_destructible<NodeType>::value);
+    void destroyTree(NodeType* root);
+    bool share(NodeStorage<NodeType, Allocator>& other);
+    std::shared_ptr<NodePool<NodeType, Allocator>> getPool();
+    void swap(NodeStorage<NodeType, Allocator>& other);
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats& getStats() const;
+#endif
+
+    // ----------- OPERATORS ------------
+    NodeStorage<NodeType, Allocator>& operator=(const NodeStorage<NodeType, Allocator>& copyStorage) = delete;
+    
+private:
+    // ------------- FIELDS -------------
+    std::shared_ptr<NodePool<NodeType, Allocator>> pool;    /**< The pool every node is allocated from, nullptr until the first node is needed. */
+    Allocator allocator;    /**< The allocator the pool is created with. */
+#if defined(DATASTRUCTURES_STATS)
+    mutable ContainerStats stats;   /**< The statistics of the data structure, they stay with this storage when it is swapped. */
+#endif
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ *
+ * @details No pool is created until the first node is needed.
+ */
+template <typename NodeType, typename Allocator>
+NodeStorage<NodeType, Allocator>::NodeStorage() : allocator() {}
+
+/**
+ * @brief   Allocator Constructor.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param allocator     The allocator the pool will be created with.
+ *
+ * @details No pool is created until the first node is needed.
+ */
+template <typename NodeType, typename Allocator>
+NodeStorage<NodeType, Allocator>::NodeStorage(const Allocator& allocator) : allocator(allocator) {}
+
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param sharedPool    The node pool this storage will allocate its nodes from.
+ */
+template <typename NodeType, typename Allocator>
+NodeStorage<NodeType, Allocator>::NodeStorage(const std::shared_ptr<NodePool<NodeType, Allocator>>& sharedPool) : pool(sharedPool), allocator() {}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Creates a new node from the node pool.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @tparam Args         The types of the node constructor arguments.
+ * @param args          The arguments forwarded to the node constructor.
+ * @return              A pointer to the newly created node.
+ *
+ * @details The node pool is created the first time a node is needed.
+ */
+template <typename NodeType, typename Allocator>
+template <typename... Args>
+NodeType* NodeStorage<NodeType, Allocator>::create(Args&&... args)
+{
+    NodeType* node = getPool()->create(std::forward<Args>(args)...);
+#if defined(DATASTRUCTURES_STATS)
+    stats.recordAllocation();
+#endif
+    return node;
+}
+
+/**
+ * @brief   Destroys a node and gives its memory back to the node pool.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param node          The node to destroy. It must have been created by this storage.
+ */
+template <typename NodeType, typename Allocator>
+void NodeStorage<NodeType, Allocator>::destroy(NodeType* node)
+{
+    pool->destroy(node);
+#if defined(DATASTRUCTURES_STATS)
+    stats.recordFree();
+#endif
+}
+
+/**
+ * @brief   Makes sure that the next nodes can be created without requesting memory.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param count         The number of nodes that will be created.
+ *
+ * @details See NodePool::reserve().
+ */
+template <typename NodeType, typename Allocator>
+void NodeStorage<NodeType, Allocator>::reserve(const int count)
+{
+    if(count > 0)
+        getPool()->reserve(count);
+}
+
+/**
+ * @brief   Destroys every node of a chain.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param first         The first node of the chain, or nullptr for an empty chain.
+ * @param link          The member that points to the next node of the chain.
+ * @param trivial       True if the node destructors do not have to run when the whole pool is released.
+ *
+ * @details Walks the chain iteratively, so it never needs more than constant stack space.
+ *          If nothing else shares the pool, the whole pool is released slab by slab instead of
+ *          node by node. Otherwise every node is given back to the shared pool for reuse.
+ */
+template <typename NodeType, typename Allocator>
+void NodeStorage<NodeType, Allocator>::destroyChain(NodeType* first, NodeType* NodeType::*link, const bool trivial)
+{
+    NodeType* node = first;
+    if(pool.use_count() == 1)   // Nothing else uses the pool, so release all of its slabs at once.
+    {
+#if defined(DATASTRUCTURES_STATS)
+        for(NodeType* counted = first; counted != nullptr; counted = counted->*link)
+            stats.recordFree();
+#endif
+        if(!trivial)
+        {
+            while(node != nullptr)
+            {
+                NodeType* nextNode = node->*link;
+                node->~NodeType();
+                node = nextNode;
+            }
+        }
+        pool->release();
+    }
+    else
+    {
+        while(node != nullptr)
+        {
+            NodeType* nextNode = node->*link;
+            destroy(node);
+            node = nextNode;
+        }
+    }
+}
+
+/**
+ * @brief   Destroys every node of a binary tree.
+ *
+ * @tparam NodeType     The node type of the data structure, with a left and a right child pointer.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param root          The root of the tree, or nullptr for an empty tree.
+ *
+ * @details Walks the tree without recursion and with constant extra space, by rotating every left
+ *          child up until the node has none, so the node can be destroyed and its right child is
+ *          handled next. If nothing else shares the pool, the whole pool is released at once, and
+ *          the walk is skipped entirely when the nodes are trivially destructible.
+ */
+template <typename NodeType, typename Allocator>
+void NodeStorage<NodeType, Allocator>::destroyTree(NodeType* root)
+{
+    bool releasePool = (pool.use_count() == 1); // Nothing else uses the pool, so release all of its slabs at once.
+    bool walkTree = !releasePool || !std::is_trivially_destructible<NodeType>::value;
+#if defined(DATASTRUCTURES_STATS)
+    walkTree = true;    // Every freed node is counted.
+#endif
+
+    if(walkTree)
+    {
+        NodeType* node = root;
+        while(node != nullptr)
+        {
+            if(node->left != nullptr)   // Rotate right, so the left child becomes the parent.
+            {
+                NodeType* leftChild = node->left;
+                node->left = leftChild->right;
+                leftChild->right = node;
+                node = leftChild;
+            }
+            else
+            {
+                NodeType* rightChild = node->right;
+                if(releasePool)
+                {
+                    node->~NodeType();
+#if defined(DATASTRUCTURES_STATS)
+                    stats.recordFree();
+#endif
+                }
+                else
+                    destroy(node);
+                node = rightChild;
+            }
+        }
+    }
+    
+    if(releasePool)
+        pool->release();
+}
+
+/**
+ * @brief   Makes this storage and another storage use the same node pool, if that can be done in place.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param other         The other storage.
+ * @return              True if both storages use the same node pool afterwards, false otherwise.
+ *
+ * @details A node pool that is used by only one of the two storages is absorbed into the pool of the
+ *          other storage, which moves its slabs over without touching any node.
+ */
+template <typename NodeType, typename Allocator>
+bool NodeStorage<NodeType, Allocator>::share(NodeStorage<NodeType, Allocator>& other)
+{
+    if(pool == other.pool)
+        return true;
+    else if(other.pool == nullptr)      // The other storage never allocated a node.
+        other.pool = pool;
+    else if(pool == nullptr)            // This storage never allocated a node.
+        pool = other.pool;
+    else if(other.pool.use_count() == 1 && pool->absorb(*other.pool))
+        other.pool = pool;
+    else if(pool.use_count() == 1 && other.pool->absorb(*pool))
+        pool = other.pool;
+    else
+        return false;
+    
+    return true;
+}
+
+/**
+ * @brief   Returns the node pool used by this storage.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @return              The shared node pool.
+ *
+ * @details The node pool is created the first time it is needed.
+ */
+template <typename NodeType, typename Allocator>
+std::shared_ptr<NodePool<NodeType, Allocator>> NodeStorage<NodeType, Allocator>::getPool()
+{
+    if(pool == nullptr)
+        pool = std::make_shared<NodePool<NodeType, Allocator>>(allocator);
+    
+    return pool;
+}
+
+/**
+ * @brief   Swaps the node pools of two storages.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @param other         The other storage.
+ */
+template <typename NodeType, typename Allocator>
+void NodeStorage<NodeType, Allocator>::swap(NodeStorage<NodeType, Allocator>& other)
+{
+    pool.swap(other.pool);
+    std::swap(allocator, other.allocator);
+}
+
+#if defined(DATASTRUCTURES_STATS)
+/**
+ * @brief   Returns the statistics of the data structure.
+ *
+ * @tparam NodeType     The node type of the data structure.
+ * @tparam Allocator    The allocator the pool requests its slabs from.
+ * @return              The statistics, which count every node this storage allocated and freed.
+ *
+ * @details The statistics can be recorded through a constant storage too, so the constant operations
+ *          of the data structure, like bfsearch(), are counted. Their counters are atomic.
+ *
+ * @note    Only available when DATASTRUCTURES_STATS is defined.
+ */
+template <typename NodeType, typename Allocator>
+ContainerStats& NodeStorage<NodeType, Allocator>::getStats() const
+{
+    return stats;
+}
+#endif
+
+} // namespace DataStructures
+
+#endif /* NodeStorage_hpp */
@@ -0,0 +1,642 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ParallelAlgorithms.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The execution policy and the node chain algorithms behind sort(), forEach(), transform(),
+ *          reduce(), findIf() and removeIf() of the node based data structures.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef ParallelAlgorithms_hpp
+#define ParallelAlgorithms_hpp
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <system_error>
+
+namespace DataStructures
+{
+
+/**
+ * @class   ExecutionPolicy
+ * @brief   Decides how many threads an algorithm splits its elements across.
+ * @details The elements are split into contiguous segments, one per thread, and every thread gets
+ *          at least the minimum segment size. The calling thread works on the first segment, so
+ *          a policy that ends up with a single segment never starts a thread.
+ *
+ *          The threads are started for every call and joined before it returns, the same way
+ *          BinaryTree::insertBulk() does, so there is no pool to set up or tear down.
+ *
+ * @note    The functions and predicates passed to an algorithm are copied once per segment and the
+ *          copies run at the same time, so they must not change anything they share without
+ *          synchronizing.
+ */
+class ExecutionPolicy
+{
+public:
+    // ----------- CONSTANTS ------------
+    static const int MIN_SEGMENT = 1 << 14;     /**< The fewest elements that are worth handing to one thread by default. */
+    
+    // ---------- CONSTRUCTORS ----------
+    explicit ExecutionPolicy(const int threadCount = 1, const int minimumSegment = MIN_SEGMENT);
+    
+    // ----------- FUNCTIONS ------------
+    static ExecutionPolicy sequential();
+    static ExecutionPolicy parallel(const int threadCount = 0, const int minimumSegment = MIN_SEGMENT);
+    int segmentsFor(const int elementCount) const;
+    static int segmentStart(const int segment, const int elementCount, const int segmentCount);
+    template <typename Job>
+    void run(const int jobCount, Job job) const;
+    template <typename Job>
+    void runSegments(const int elementCount, const int segmentCount, Job job) const;
+    
+private:
+    // ------------- FIELDS -------------
+    int threadCount;        /**< The most threads to use, 0 for one per hardware thread. */
+    int minimumSegment;     /**< The fewest elements one thread gets. */
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Constructor.
+ *
+ * @param threadCount       The most threads to use, 0 for one per hardware thread. 1 runs everything
+ *                          on the calling thread, which is the default.
+ * @param minimumSegment    The fewest elements one thread gets. Use a smaller value when every
+ *                          element takes a long time to process.
+ */
+inline ExecutionPolicy::ExecutionPolicy(const int threadCount, const int minimumSegment) : threadCount(threadCount), minimumSegment(minimumSegment) {}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Returns a policy that runs everything on the calling thread.
+ *
+ * @return  The sequential policy.
+ */
+inline ExecutionPolicy ExecutionPolicy::sequential()
+{
+    return ExecutionPolicy(1);
+}
+
+/**
+ * @brief   Returns a policy that splits the elements across several threads.
+ *
+ * @param threadCount       The most threads to use, 0 for one per hardware thread.
+ * @param minimumSegment    The fewest elements one thread gets.
+ * @return                  The parallel policy.
+ */
+inline ExecutionPolicy ExecutionPolicy::parallel(const int threadCount, const int minimumSegment)
+{
+    return ExecutionPolicy(threadCount, minimumSegment);
+}
+
+/**
+ * @brief   Returns the number of segments to split a number of elements into.
+ *
+ * @param elementCount  The number of elements.
+ * @return              The number of threads to use, at least 1.
+ *
+ * @details Every segment gets at least the minimum segment size and never fewer than 2 elements,
+ *          so reduce() can start every segment from two of its own elements.
+ */
+inline int ExecutionPolicy::segmentsFor(const int elementCount) const
+{
+    int threads = threadCount;
+    if(threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    
+    int segmentSize = (minimumSegment > 2) ? minimumSegment : 2;
+    int segments = elementCount / segmentSize;
+    if(segments > threads)
+        segments = threads;
+    
+    return (segments > 1) ? segments : 1;
+}
+
+/**
+ * @brief   Returns the index of the first element of a segment.
+ *
+ * @param segment       The segment, from 0 to segmentCount. segmentCount gives the element count.
+ * @param elementCount  The number of elements.
+ * @param segmentCount  The number of segments.
+ * @return              The index of the first element of the segment.
+ *
+ * @details The segments differ in size by at most one element.
+ */
+inline int ExecutionPolicy::segmentStart(const int segment, const int elementCount, const int segmentCount)
+{
+    return (int)((long long)segment * elementCount / segmentCount);
+}
+
+/**
+ * @brief   Runs a number of jobs at the same time and waits for all of them.
+ *
+ * @tparam Job      A callable that takes the number of the job, from 0 to jobCount-1.
+ * @param jobCount  The number of jobs.
+ * @param job       The job.
+ *
+ * @details Job 0 runs on the calling thread and every other job on a thread of its own. If a
+ *          thread cannot be started, the jobs that are left run on the calling thread instead.
+ *
+ * @throw   Rethrows the exception of the lowest numbered job that threw, once every job is done.
+ */
+template <typename Job>
+void ExecutionPolicy::run(const int jobCount, Job job) const
+{
+    std::vector<std::exception_ptr> errors(jobCount);
+    auto runJob = [&job, &errors](const int jobNumber)
+    {
+        try
+        {
+            job(jobNumber);
+        }
+        catch(...)
+        {
+            errors[jobNumber] = std::current_exception();
+        }
+    };
+    
+    std::vector<std::thread> workers;
+    workers.reserve(jobCount);
+    int started = 1;
+    for(; started < jobCount; started++)
+    {
+        try
+        {
+            workers.push_back(std::thread(runJob, started));
+        }
+        catch(const std::system_error&)
+        {
+            break;
+        }
+    }
+    
+    runJob(0);
+    for(int jobNumber = started; jobNumber < jobCount; jobNumber++)
+        runJob(jobNumber);
+    for(std::thread& worker : workers)
+        worker.join();
+    
+    for(std::exception_ptr& error : errors)
+        if(error)
+            std::rethrow_exception(error);
+}
+
+/**
+ * @brief   Splits a number of elements into segments and runs a job on every segment at the same time.
+ *
+ * @tparam Job          A callable that takes the segment, the index of its first element and the
+ *                      index one past its last element.
+ * @param elementCount  The number of elements.
+ * @param segmentCount  The number of segments, usually segmentsFor(elementCount).
+ * @param job           The job.
+ *
+ * @throw   Rethrows the exception of the lowest segment that threw, once every segment is done.
+ */
+template <typename Job>
+void ExecutionPolicy::runSegments(const int elementCount, const int segmentCount, Job job) const
+{
+    run(segmentCount, [&job, elementCount, segmentCount](const int segment)
+    {
+        job(segment, segmentStart(segment, elementCount, segmentCount), segmentStart(segment+1, elementCount, segmentCount));
+    });
+}
+
+/**
+ * @brief   Splits a chain of nodes into segments and runs a job on every segment at the same time.
+ *
+ * @tparam Node         A node with a next pointer.
+ * @tparam Job          A callable that takes the segment, its first node, the node past its last node
+ *                      and the index of its first node.
+ * @param head          The first node of the chain.
+ * @param count         The number of nodes in the chain.
+ * @param segmentCount  The number of segments, usually policy.segmentsFor(count).
+ * @param policy        The execution policy.
+ * @param job           The job.
+ *
+ * @details The chain is walked once on the calling thread to find where the segments start.
+ *          A single segment is the whole chain and runs without the walk.
+ *
+ * @throw   Rethrows the exception of the lowest segment that threw, once every segment is done.
+ */
+template <typename Node, typename Job>
+void forEachSegment(Node* head, const int count, const int segmentCount, const ExecutionPolicy& policy, Job job)
+{
+    if(segmentCount == 1)
+    {
+        job(0, head, (Node*)nullptr, 0);
+        return;
+    }
+    
+    std::vector<Node*> starts(segmentCount+1, nullptr);
+    Node* node = head;
+    int index = 0;
+    for(int segment = 0; segment < segmentCount; segment++)
+    {
+        for(int start = ExecutionPolicy::segmentStart(segment, count, segmentCount); index < start; index++)
+            node = node->next;
+        starts[segment] = node;
+    }
+    
+    policy.runSegments(count, segmentCount, [&job, &starts](const int segment, const int first, const int)
+    {
+        job(segment, starts[segment], starts[segment+1], first);
+    });
+}
+
+/**
+ * @brief   Calls a function on the data of every node of a chain.
+ *
+ * @tparam Node     A node with a next pointer and a data field.
+ * @tparam Function A callable that takes a reference to the data.
+ * @param head      The first node of the chain.
+ * @param count     The number of nodes in the chain.
+ * @param visit     The function, copied once per segment.
+ * @param policy    The execution policy.
+ */
+template <typename Node, typename Function>
+void forEachInChain(Node* head, const int count, Function visit, const ExecutionPolicy& policy)
+{
+    forEachSegment(head, count, policy.segmentsFor(count), policy, [&visit](const int, Node* first, Node* end, const int)
+    {
+        Function segmentVisit(visit);
+        for(Node* node = first; node != end; node = node->next)
+            segmentVisit(node->data);
+    });
+}
+
+/**
+ * @brief   Combines the data of every node of a chain.
+ *
+ * @tparam Node     A node with a next pointer and a data field.
+ * @tparam Result   The type of the result.
+ * @tparam Combine  A callable that combines any mix of a Result and the data into a Result.
+ * @param head      The first node of the chain.
+ * @param count     The number of nodes in the chain.
+ * @param init      The value the result starts from.
+ * @param combine   The combination. It must be associative and commutative, like for std::reduce().
+ * @param policy    The execution policy.
+ * @return          The combination of init and the data of every node.
+ *
+ * @details On a single segment the data is combined from head to tail. Otherwise every segment
+ *          combines its own nodes, starting from its first two, and the segment results are
+ *          combined with init in segment order.
+ */
+template <typename Node, typename Result, typename Combine>
+Result reduceChain(Node* head, const int count, Result init, Combine combine, const ExecutionPolicy& policy)
+{
+    int segmentCount = policy.segmentsFor(count);
+    if(segmentCount == 1)
+    {
+        for(Node* node = head; node != nullptr; node = node->next)
+            init = combine(std::move(init), node->data);
+        return init;
+    }
+    
+    std::vector<Result> partials(segmentCount, init);
+    forEachSegment(head, count, segmentCount, policy, [&combine, &partials](const int segment, Node* first, Node* end, const int)
+    {
+        Combine segmentCombine(combine);
+        Result partial = segmentCombine(first->data, first->next->data);
+        for(Node* node = first->next->next; node != end; node = node->next)
+            partial = segmentCombine(std::move(partial), node->data);
+        partials[segment] = std::move(partial);
+    });
+    
+    for(Result& partial : partials)
+        init = combine(std::move(init), std::move(partial));
+    return init;
+}
+
+/**
+ * @brief   Combines the data of every node of a chain into a result of another type.
+ *
+ * @tparam Node         A node with a next pointer and a data field.
+ * @tparam Result       The type of the result.
+ * @tparam Accumulate   A callable that adds the data to a Result and returns the new Result.
+ * @tparam Combine      A callable that combines two Results into one.
+ * @param head          The first node of the chain.
+ * @param count         The number of nodes in the chain.
+ * @param identity      The value every segment starts from, which combine() must leave unchanged.
+ * @param accumulate    The accumulation, copied once per segment.
+ * @param combine       The combination of the segment results. It must be associative.
+ * @param policy        The execution policy.
+ * @return              The result of the first segment combined with the results of the later ones, in order.
+ *
+ * @details Unlike the other reduceChain(), the data never has to be combined with itself, so this one
+ *          can, for example, add up one field of every element.
+ */
+template <typename Node, typename Result, typename Accumulate, typename Combine>
+Result reduceChain(Node* head, const int count, Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy)
+{
+    int segmentCount = policy.segmentsFor(count);
+    if(segmentCount == 1)
+    {
+        for(Node* node = head; node != nullptr; node = node->next)
+            identity = accumulate(std::move(identity), node->data);
+        return identity;
+    }
+    
+    std::vector<Result> partials(segmentCount, identity);
+    forEachSegment(head, count, segmentCount, policy, [&accumulate, &partials](const int segment, Node* first, Node* end, const int)
+    {
+        Accumulate segmentAccumulate(accumulate);
+        for(Node* node = first; node != end; node = node->next)
+            partials[segment] = segmentAccumulate(std::move(partials[segment]), node->data);
+    });
+    
+    Result result = std::move(partials[0]);
+    for(int segment = 1; segment < segmentCount; segment++)
+        result = combine(std::move(result), std::move(partials[segment]));
+    return result;
+}
+
+/**
+ * @brief   Returns the first node of a chain whose data matches a predicate.
+ *
+ * @tparam Node         A node with a next pointer and a data field.
+ * @tparam Predicate    A callable that takes the data and returns true if it matches.
+ * @param head          The first node of the chain.
+ * @param count         The number of nodes in the chain.
+ * @param predicate     The predicate, copied once per segment.
+ * @param policy        The execution policy.
+ * @return              The first matching node, or nullptr if none matches.
+ *
+ * @details Every segment stops at its first match, or as soon as an earlier segment found one.
+ */
+template <typename Node, typename Predicate>
+Node* findInChain(Node* head, const int count, Predicate predicate, const ExecutionPolicy& policy)
+{
+    int segmentCount = policy.segmentsFor(count);
+    std::vector<Node*> matches(segmentCount, nullptr);
+    std::atomic<int> firstMatch(segmentCount);  // The lowest segment with a match so far.
+    forEachSegment(head, count, segmentCount, policy, [&predicate, &matches, &firstMatch](const int segment, Node* first, Node* end, const int)
+    {
+        Predicate segmentPredicate(predicate);
+        int checked = 0;
+        for(Node* node = first; node != end; node = node->next)
+        {
+            if(segmentPredicate(node->data))
+            {
+                matches[segment] = node;
+                int lowest = firstMatch.load(std::memory_order_relaxed);
+                while(segment < lowest && !firstMatch.compare_exchange_weak(lowest, segment, std::memory_order_relaxed)) {}
+                return;
+            }
+            if(++checked % 1024 == 0 && firstMatch.load(std::memory_order_relaxed) < segment)   // An earlier segment already found one.
+                return;
+        }
+    });
+    
+    for(Node* match : matches)
+        if(match != nullptr)
+            return match;
+    return nullptr;
+}
+
+/**
+ * @brief   Tests the data of every node of a chain against a predicate.
+ *
+ * @tparam Node         A node with a next pointer and a data field.
+ * @tparam Predicate    A callable that takes the data and returns true if it matches.
+ * @param head          The first node of the chain.
+ * @param count         The number of nodes in the chain.
+ * @param predicate     The predicate, copied once per segment.
+ * @param policy        The execution policy.
+ * @return              One flag per node, in chain order, that is 1 if the node matches.
+ *
+ * @details Used by removeIf(), which unlinks the matching nodes on the calling thread afterwards.
+ */
+template <typename Node, typename Predicate>
+std::vector<char> matchChain(Node* head, const int count, Predicate predicate, const ExecutionPolicy& policy)
+{
+    std::vector<char> matches(count, 0);
+    forEachSegment(head, count, policy.segmentsFor(count), policy, [&predicate, &matches](const int, Node* first, Node* end, const int firstIndex)
+    {
+        Predicate segmentPredicate(predicate);
+        int index = firstIndex;
+        for(Node* node = first; node != end; node = node->next)
+            matches[index++] = segmentPredicate(node->data) ? 1 : 0;
+    });
+    
+    return matches;
+}
+
+/**
+ * @brief   Merges a sorted chain of nodes into another sorted chain.
+ *
+ * @tparam Node     A node with a next pointer and a data field.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param first     The first sorted chain. Receives the merged chain.
+ * @param second    The second sorted chain. Is nullptr afterwards.
+ * @param compare   The comparison both chains are sorted by.
+ *
+ * @details The merge is stable, equal nodes of the first chain stay in front of the ones from the
+ *          second chain. Only the next pointers are changed.
+ *
+ * @throw   Rethrows an exception of the comparison. Every node is still in the first chain then,
+ *          although not in sorted order.
+ */
+template <typename Node, typename Compare>
+void mergeChains(Node*& first, Node*& second, Compare& compare)
+{
+    Node* merged = nullptr;
+    Node** link = &merged;  // The next pointer that receives the next merged node.
+    try
+    {
+        while(first != nullptr && second != nullptr)
+        {
+            Node** smaller = compare(second->data, first->data) ? &second : &first;
+            *link = *smaller;
+            *smaller = (*smaller)->next;
+            link = &(*link)->next;
+        }
+    }
+    catch(...)
+    {
+        // Keep every node in one chain: the merged part, then the rest of both chains.
+        *link = first;
+        while(*link != nullptr)
+            link = &(*link)->next;
+        *link = second;
+        first = merged;
+        second = nullptr;
+        throw;
+    }
+    
+    *link = (first != nullptr) ? first : second;
+    first = merged;
+    second = nullptr;
+}
+
+/**
+ * @brief   Sorts a chain of nodes with a bottom up merge sort.
+ *
+ * @tparam Node     A node with a next pointer and a data field.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param head      The first node of the chain. Receives the first node of the sorted chain.
+ * @param compare   The comparison to sort by.
+ *
+ * @details The sort is stable and takes O(n log n) time. It relinks the next pointers and needs no
+ *          memory besides a fixed array of sorted runs, one for every power of two.
+ *
+ * @throw   Rethrows an exception of the comparison. Every node is still in the chain then,
+ *          although not in sorted order.
+ */
+template <typename Node, typename Compare>
+void sortChain(Node*& head, Compare& compare)
+{
+    const int RUN_COUNT = 32;                   // A run of more than INT_MAX nodes is never needed.
+    Node* runs[RUN_COUNT] = {};                 // runs[i] is nullptr or a sorted run of 2^i nodes.
+    Node* carry = nullptr;
+    try
+    {
+        while(head != nullptr)
+        {
+            carry = head;
+            head = head->next;
+            carry->next = nullptr;
+            
+            // Merge the carry with the runs of equal length, the older run goes first to keep the sort stable.
+            int run = 0;
+            for(; runs[run] != nullptr; run++)
+            {
+                mergeChains(runs[run], carry, compare);
+                carry = runs[run];
+                runs[run] = nullptr;
+            }
+            runs[run] = carry;
+            carry = nullptr;
+        }
+        
+        for(int run = 0; run < RUN_COUNT; run++)
+        {
+            if(runs[run] == nullptr)
+                continue;
+            
+            mergeChains(runs[run], head, compare);
+            head = runs[run];
+            runs[run] = nullptr;
+        }
+    }
+    catch(...)
+    {
+        // Put every node back into one chain.
+        Node* rest = head;
+        head = nullptr;
+        Node** link = &head;
+        Node* chains[RUN_COUNT + 2];
+        chains[0] = carry;
+        chains[1] = rest;
+        for(int run = 0; run < RUN_COUNT; run++)
+            chains[run+2] = runs[run];
+        for(Node* chain : chains)
+        {
+            *link = chain;
+            while(*link != nullptr)
+                link = &(*link)->next;
+        }
+        throw;
+    }
+}
+
+/**
+ * @brief   Sorts a chain of nodes, splitting the work across threads.
+ *
+ * @tparam Node     A node with a next pointer and a data field.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param head      The first node of the chain. Receives the first node of the sorted chain.
+ * @param count     The number of nodes in the chain.
+ * @param compare   The comparison to sort by, copied once per segment.
+ * @param policy    The execution policy.
+ *
+ * @details The chain is cut into one chain per segment, every segment is sorted on its own thread,
+ *          and then the sorted segments are merged in pairs, the pairs of each round at the same time.
+ *          The sort is stable. Only the next pointers are changed, no node is allocated or freed,
+ *          so the node pool is never touched from another thread.
+ *
+ * @throw   Rethrows an exception of the comparison. Every node is still in the chain then,
+ *          although not in sorted order.
+ */
+template <typename Node, typename Compare>
+void sortChain(Node*& head, const int count, Compare compare, const ExecutionPolicy& policy)
+{
+    int segmentCount = policy.segmentsFor(count);
+    if(segmentCount == 1)
+    {
+        sortChain(head, compare);
+        return;
+    }
+    
+    // Cut the chain into one chain per segment.
+    std::vector<Node*> segments(segmentCount, nullptr);
+    Node* node = head;
+    for(int segment = 0; segment < segmentCount; segment++)
+    {
+        segments[segment] = node;
+        int length = ExecutionPolicy::segmentStart(segment+1, count, segmentCount) - ExecutionPolicy::segmentStart(segment, count, segmentCount);
+        for(int i = 1; i < length; i++)
+            node = node->next;
+        Node* nextNode = node->next;
+        node->next = nullptr;
+        node = nextNode;
+    }
+    head = nullptr;
+    
+    try
+    {
+        policy.run(segmentCount, [&segments, &compare](const int segment)
+        {
+            Compare segmentCompare(compare);
+            sortChain(segments[segment], segmentCompare);
+        });
+        
+        for(int width = 1; width < segmentCount; width *= 2)
+            policy.run((segmentCount + 2*width - 1) / (2*width), [&segments, &compare, segmentCount, width](const int pair)
+            {
+                int first = pair * 2*width;
+                if(first + width >= segmentCount)
+                    return;
+                Compare pairCompare(compare);
+                mergeChains(segments[first], segments[first + width], pairCompare);
+            });
+    }
+    catch(...)
+    {
+        // Put every node back into one chain.
+        Node** link = &head;
+        for(Node* chain : segments)
+        {
+            *link = chain;
+            while(*link != nullptr)
+                link = &(*link)->next;
+        }
+        throw;
+    }
+    
+    head = segments[0];
+}
+
+} // namespace DataStructures
+
+#endif /* ParallelAlgorithms_hpp */
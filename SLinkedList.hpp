@@ -14,42 +14,120 @@
 #ifndef SLinkedList_hpp
 #define SLinkedList_hpp
 
+#include <memory>
+#include <initializer_list>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <vector>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include "NodeStorage.hpp"
+#include "Serialization.hpp"
+#include "BufferedWriter.hpp"
+#include "ParallelAlgorithms.hpp"
+
+namespace DataStructures
+{
 
 /**
- * @struct  Node
- * @brief   The Node struct is meant to hold the data and pointer to the next list element.
+ * @struct  SListNode
+ * @brief   The SListNode struct is meant to hold the data and pointer to the next list element.
  *
  * @tparam T    Any data type or class.
  */
 template <typename T>
-struct Node
+struct SListNode
 {
     // ------------- FIELDS -------------
-    T data;         /**< The data. */
-    Node<T>* next;  /**< Pointer to the next node in the list. */
+    T data;              /**< The data. */
+    SListNode<T>* next;  /**< Pointer to the next node in the list. */
     
     // ---------- CONSTRUCTORS ----------
     /** Copy Constructor. */
-    Node(const T& data) : data(data), next(nullptr) {}
+    SListNode(const T& data) : data(data), next(nullptr) {}
     /** Move Constructor. */
-    Node(T&& data) : data(std::forward<T>(data)), next(nullptr) {}
-    /** Struct Destructor. */
-    ~Node()
+    SListNode(T&& data) : data(std::forward<T>(data)), next(nullptr) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    SListNode(EmplaceTag, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    friend std::ostream& operator<<(std::ostream& output, const SListNode<T>& node)
     {
-        delete next;
-        next = nullptr;
+        output << node.data;
+        for(const SListNode<T>* nextNode = node.next; nextNode != nullptr; nextNode = nextNode->next)
+            output << ", " << nextNode->data;
+        
+        return output;
     }
+};
+
+template <typename T>
+class SLinkedList;
+
+/**
+ * @class   SLinkedListIterator
+ * @brief   A forward iterator over the elements of a Singly Linked List.
+ * @details Besides the node it points to, the iterator remembers the node before it,
+ *          which lets SLinkedList::erase() unlink the node in constant time.
+ * @tparam T        Any data type or class.
+ * @tparam IsConst  True for an iterator that only gives constant access to the elements.
+ *
+ * @warning Erasing an element invalidates iterators to it and to the element after it.
+ *          Inserting after an element invalidates iterators to the element that followed it
+ *          and the end() iterator when the element is the tail.
+ */
+template <typename T, bool IsConst>
+class SLinkedListIterator
+{
+public:
+    // -------------- TYPES -------------
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+    typedef typename std::conditional<IsConst, const T&, T&>::type reference;
     
-    // ----- NON-MEMEBER OPERATORS ------
-    friend std::ostream& operator<<(std::ostream& output, const Node<T>& node)
+    // ---------- CONSTRUCTORS ----------
+    /** Default Constructor. */
+    SLinkedListIterator() : previous(nullptr), node(nullptr) {}
+    /** Conversion Constructor from a mutable iterator to a constant iterator. */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    SLinkedListIterator(const SLinkedListIterator<T, OtherConst>& other) : previous(other.previous), node(other.node) {}
+    
+    // ----------- OPERATORS ------------
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+    SLinkedListIterator& operator++()
     {
-        if(node.next)
-            return output << node.data << ", " << *node.next;
-        else
-            return output << node.data;
+        previous = node;
+        node = node->next;
+        return *this;
     }
+    SLinkedListIterator operator++(int)
+    {
+        SLinkedListIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    template <bool OtherConst>
+    bool operator==(const SLinkedListIterator<T, OtherConst>& other) const { return node == other.node; }
+    template <bool OtherConst>
+    bool operator!=(const SLinkedListIterator<T, OtherConst>& other) const { return node != other.node; }
+    
+private:
+    // ------------- FIELDS -------------
+    SListNode<T>* previous;  /**< The node before the current node, nullptr at the head of the list. */
+    SListNode<T>* node;      /**< The current node, nullptr past the end of the list. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Node Constructor. */
+    SLinkedListIterator(SListNode<T>* previous, SListNode<T>* node) : previous(previous), node(node) {}
+    
+    friend class SLinkedList<T>;
+    friend class SLinkedListIterator<T, !IsConst>;
 };
 
 /**
@@ -62,30 +140,96 @@ template <typename T>
 class SLinkedList
 {
 public:
+    // -------------- TYPES -------------
+    typedef SLinkedListIterator<T, false> iterator;
+    typedef SLinkedListIterator<T, true> const_iterator;
+    
     // ---------- CONSTRUCTORS ----------
     SLinkedList();
+    explicit SLinkedList(const std::shared_ptr<NodePool<SListNode<T>>>& sharedPool);
+    template <typename InputIterator>
+    SLinkedList(InputIterator first, InputIterator last);
+    SLinkedList(std::initializer_list<T> elements);
     SLinkedList(const SLinkedList<T>& copyList);
-    SLinkedList(SLinkedList<T>&& moveList);
+    SLinkedList(SLinkedList<T>&& moveList) noexcept;
     ~SLinkedList();
     
     // ----------- FUNCTIONS ------------
-    void addFirst(const T data);
-    void addLast(const T data);
-    void insert(const T data, const int index);
+    void addFirst(const T& data);
+    void addFirst(T&& data);
+    void addLast(const T& data);
+    void addLast(T&& data);
+    void insert(const T& data, const int index);
+    void insert(T&& data, const int index);
+    template <typename... Args>
+    void emplaceFirst(Args&&... args);
+    template <typename... Args>
+    void emplaceLast(Args&&... args);
+    template <typename... Args>
+    void emplace(const int index, Args&&... args);
     void remove(const int index);
+    iterator insertAfter(const_iterator position, const T& data);
+    iterator insertAfter(const_iterator position, T&& data);
+    template <typename... Args>
+    iterator emplaceAfter(const_iterator position, Args&&... args);
+    iterator erase(const_iterator position);
+    void splice(SLinkedList<T>& other);
+    void splice(const_iterator position, SLinkedList<T>& other, const_iterator first, const_iterator last);
+    SLinkedList<T> splitAt(const int index);
+    void merge(SLinkedList<T>& other);
+    template <typename Compare>
+    void merge(SLinkedList<T>& other, Compare compare);
+    void sort(const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Compare>
+    void sort(Compare compare, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Function>
+    void forEach(Function visit, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Function>
+    void transform(Function function, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Result, typename Combine>
+    Result reduce(Result init, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Result, typename Accumulate, typename Combine>
+    Result reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    iterator findIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy());
+    template <typename Predicate>
+    const_iterator findIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy()) const;
+    template <typename Predicate>
+    int removeIf(Predicate predicate, const ExecutionPolicy& policy = ExecutionPolicy());
     void clear();
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last);
     T pop();
     T pop(const int index);
-    T peek();
-    T peek(const int index);
-    int size();
-    bool empty();
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    T& peek(const int index);
+    const T& peek(const int index) const;
+    int size() const;
+    bool empty() const;
+    std::shared_ptr<NodePool<SListNode<T>>> getPool();
+#if defined(DATASTRUCTURES_STATS)
+    const ContainerStats& stats();
+#endif
+    void serialize(std::ostream& output) const;
+    void deserialize(std::istream& input);
+    void serializeFlat(std::ostream& output) const;
+    void deserializeFlat(const void* data, const std::size_t bytes);
+    template <typename Sink>
+    void writeTo(Sink& sink, const char* separator = ", ") const;
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
     
     // ----------- OPERATORS ------------
     T& operator[](const int index);
     bool operator==(const SLinkedList& compareList);
     SLinkedList<T>& operator=(const SLinkedList& copyList);
-    SLinkedList<T>& operator=(SLinkedList&& moveList);
+    SLinkedList<T>& operator=(SLinkedList&& moveList) noexcept;
     
     // ----- NON-MEMEBER OPERATORS ------
     template <typename Type>
@@ -93,16 +237,19 @@ public:
     
 private:
     // ------------- FIELDS -------------
-    Node<T>* head;  /**< The head of the list. */
-    Node<T>* tail;  /**< The tail of the lsit. */
-    int listSize;   /**< The size of the list. */
+    SListNode<T>* head;               /**< The head of the list. */
+    SListNode<T>* tail;               /**< The tail of the lsit. */
+    int listSize;                     /**< The size of the list. */
+    NodeStorage<SListNode<T>> nodes;  /**< Allocates every node of the list from a shared node pool. */
     
     // ----------- FUNCTIONS ------------
+    void copyFrom(const SLinkedList<T>& copyList);
+    SListNode<T>* nodeAt(const int index) const;
+    void relinkTail();
+    void adoptNodes(SLinkedList<T>& other);
     void swap(SLinkedList<T>& other);
 };
 
-#endif /* SLinkedList_hpp */
-
 
 // **************************************************************************
 // **************************************************************************
@@ -123,26 +270,62 @@ private:
 template <typename T>
 SLinkedList<T>::SLinkedList() : head(nullptr), tail(nullptr), listSize(0) {}
 
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @param sharedPool    The node pool this linked list object will allocate its nodes from.
+ *
+ * @details Initializes an empty linked list object that shares its node pool with every other
+ *          list constructed from the same pool. Nodes freed by any of those lists are recycled
+ *          by all of them.
+ */
+template <typename T>
+SLinkedList<T>::SLinkedList(const std::shared_ptr<NodePool<SListNode<T>>>& sharedPool) : head(nullptr), tail(nullptr), listSize(0), nodes(sharedPool) {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Initializes this list object with the elements of the range. See assign().
+ */
+template <typename T>
+template <typename InputIterator>
+SLinkedList<T>::SLinkedList(InputIterator first, InputIterator last) : SLinkedList()
+{
+    assign(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param elements  The elements this list object will hold.
+ *
+ * @details Initializes this list object with the elements of the list. See assign().
+ */
+template <typename T>
+SLinkedList<T>::SLinkedList(std::initializer_list<T> elements) : SLinkedList()
+{
+    assign(elements.begin(), elements.end());
+}
+
 /**
  * @brief   Copy Constructor.
  *
  * @tparam T        Any data type or class.
  * @param copyList  The list whose contents will be copied into this linked list object.
+ *
+ * @details Every node is reserved from the node pool with a single allocation.
  */
 template <typename T>
 SLinkedList<T>::SLinkedList(const SLinkedList<T>& copyList) : head(nullptr), tail(nullptr), listSize(0)
 {
-    Node<T>** currentNode = &head;
-    for(Node<T>* copyNode = copyList.head; copyNode; copyNode = copyNode->next)
-    {
-        (*currentNode) = new Node<T>(copyNode->data);
-        
-        if(copyNode->next == nullptr)
-            tail = *currentNode;
-        
-        currentNode = &(*currentNode)->next;
-        listSize++;
-    }
+    copyFrom(copyList);
 }
 
 /**
@@ -151,24 +334,15 @@ SLinkedList<T>::SLinkedList(const SLinkedList<T>& copyList) : head(nullptr), tai
  * @tparam T        Any data type or class.
  * @param moveList  The list whose contents will be moved into this linked list object.
  *
+ * @details Takes over the nodes of the provided linked list in constant time,
+ *          without allocating. The provided linked list object is empty afterwards.
+ *
  * @note std::move() needs to be used to call this constructor.
  */
 template <typename T>
-SLinkedList<T>::SLinkedList(SLinkedList<T>&& moveList) : head(nullptr), tail(nullptr), listSize(0)
+SLinkedList<T>::SLinkedList(SLinkedList<T>&& moveList) noexcept : head(nullptr), tail(nullptr), listSize(0)
 {
-    Node<T>** currentNode = &head;
-    for(Node<T>* moveNode = moveList.head; moveNode; moveNode = moveNode->next)
-    {
-        (*currentNode) = new Node<T>(std::move(moveNode->data));
-        
-        if(moveNode->next == nullptr)
-            tail = *currentNode;
-        
-        currentNode = &(*currentNode)->next;
-        listSize++;
-    }
-
-    moveList.clear();
+    moveList.swap(*this);
 }
 
 /**
@@ -176,7 +350,7 @@ SLinkedList<T>::SLinkedList(SLinkedList<T>&& moveList) : head(nullptr), tail(nul
  *
  * @tparam T    Any data type or class.
  *
- * @details Recursively clears the list using clear() function.
+ * @details Clears the list using clear() function.
  */
 template <typename T>
 SLinkedList<T>::~SLinkedList()
@@ -195,9 +369,85 @@ SLinkedList<T>::~SLinkedList()
  * @param data  The data you want to add to the list.
  */
 template <typename T>
-void SLinkedList<T>::addFirst(const T data)
+void SLinkedList<T>::addFirst(const T& data)
+{
+    emplaceFirst(data);
+}
+
+/**
+ * @brief   Moves data to the front of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ */
+template <typename T>
+void SLinkedList<T>::addFirst(T&& data)
+{
+    emplaceFirst(std::move(data));
+}
+
+/**
+ * @brief   Adds data to the end of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to add to the list.
+ */
+template <typename T>
+void SLinkedList<T>::addLast(const T& data)
+{
+    emplaceLast(data);
+}
+
+/**
+ * @brief   Moves data to the end of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ */
+template <typename T>
+void SLinkedList<T>::addLast(T&& data)
+{
+    emplaceLast(std::move(data));
+}
+
+/**
+ * @brief   Inserts data into the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to add to the list.
+ * @param index Index at which to add the data into the list.
+ */
+template <typename T>
+void SLinkedList<T>::insert(const T& data, const int index)
+{
+    emplace(index, data);
+}
+
+/**
+ * @brief   Moves data into the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The data you want to move into the list.
+ * @param index Index at which to add the data into the list.
+ */
+template <typename T>
+void SLinkedList<T>::insert(T&& data, const int index)
+{
+    emplace(index, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place at the front of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the data.
+ */
+template <typename T>
+template <typename... Args>
+void SLinkedList<T>::emplaceFirst(Args&&... args)
 {
-    Node<T>* node_newHead = new Node<T>(data);
+    SListNode<T>* node_newHead = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
     if(head == nullptr)
         tail = node_newHead;
     else
@@ -208,15 +458,17 @@ void SLinkedList<T>::addFirst(const T data)
 }
 
 /**
- * @brief   Adds data to the end of the list.
+ * @brief   Constructs data in place at the end of the list.
  *
  * @tparam T    Any data type or class.
- * @param data  The data you want to add to the list.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the data.
  */
 template <typename T>
-void SLinkedList<T>::addLast(const T data)
+template <typename... Args>
+void SLinkedList<T>::emplaceLast(Args&&... args)
 {
-    Node<T>* node_newTail = new Node<T>(data);
+    SListNode<T>* node_newTail = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
     if(head == nullptr)
         head = node_newTail;
     else
@@ -227,23 +479,30 @@ void SLinkedList<T>::addLast(const T data)
 }
 
 /**
- * @brief   Inserts data into the list at the specified index.
+ * @brief   Constructs data in place at the specified index of the list.
  *
  * @tparam T    Any data type or class.
- * @param data  The data you want to add to the list.
+ * @tparam Args The types of the constructor arguments.
  * @param index Index at which to add the data into the list.
+ * @param args  The arguments forwarded to the constructor of the data.
  */
 template <typename T>
-void SLinkedList<T>::insert(const T data, const int index)
+template <typename... Args>
+void SLinkedList<T>::emplace(const int index, Args&&... args)
 {
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::INSERT);
+    if(index > 0 && index < listSize)
+        nodes.getStats().recordTraversal(ContainerStats::INSERT, index-1);
+#endif
     if(index <= 0)
-        addFirst(data);
+        emplaceFirst(std::forward<Args>(args)...);
     else if(index >= listSize)
-        addLast(data);
+        emplaceLast(std::forward<Args>(args)...);
     else
     {
-        Node<T>* node = new Node<T>(data);
-        Node<T>* temp = head;
+        SListNode<T>* node = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+        SListNode<T>* temp = head;
         for(int i = 1; i < index; i++)
             temp = temp->next;
         
@@ -265,8 +524,12 @@ void SLinkedList<T>::remove(const int index)
     // Do nothing if list is empty or index out of range.
     if(listSize == 0 || index < 0 || index >= listSize)
         return;
-    
-    Node<T>* deleteNode = head;
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::REMOVE);
+    nodes.getStats().recordTraversal(ContainerStats::REMOVE, (index > 0) ? index-1 : 0);
+#endif
+
+    SListNode<T>* deleteNode = head;
     
     if(index == 0)  // Remove the head of list.
     {
@@ -276,7 +539,7 @@ void SLinkedList<T>::remove(const int index)
     }
     else if(index == listSize-1)    // Removing the tail of list.
     {
-        Node<T>* temp = head;
+        SListNode<T>* temp = head;
         for(int i = 1; i < listSize-1; i++)
             temp = temp->next;
         
@@ -286,39 +549,608 @@ void SLinkedList<T>::remove(const int index)
     }
     else
     {
-        Node<T>* temp = head;
-        for(int i = 1; i < index; i++)
-            temp = temp->next;
+        SListNode<T>* temp = head;
+        for(int i = 1; i < index; i++)
+            temp = temp->next;
+        
+        deleteNode = temp->next;
+        temp->next = deleteNode->next;
+    }
+    
+    nodes.destroy(deleteNode);
+    listSize--;
+}
+
+/**
+ * @brief   Inserts data into the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to add to the list.
+ * @return          An iterator to the added data.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename SLinkedList<T>::iterator SLinkedList<T>::insertAfter(const_iterator position, const T& data)
+{
+    return emplaceAfter(position, data);
+}
+
+/**
+ * @brief   Moves data into the list right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element after which to add the data.
+ * @param data      The data you want to move into the list.
+ * @return          An iterator to the added data.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename SLinkedList<T>::iterator SLinkedList<T>::insertAfter(const_iterator position, T&& data)
+{
+    return emplaceAfter(position, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place right after the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Args     The types of the constructor arguments.
+ * @param position  Iterator to the element after which to add the data.
+ * @param args      The arguments forwarded to the constructor of the data.
+ * @return          An iterator to the added data.
+ *
+ * @details Links the new node in constant time, without walking the list.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+template <typename... Args>
+typename SLinkedList<T>::iterator SLinkedList<T>::emplaceAfter(const_iterator position, Args&&... args)
+{
+    SListNode<T>* node = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
+    node->next = position.node->next;
+    position.node->next = node;
+    
+    if(position.node == tail)
+        tail = node;
+    
+    listSize++;
+    return iterator(position.node, node);
+}
+
+/**
+ * @brief   Removes the data at the specified position from the list.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element to remove.
+ * @return          An iterator to the element that followed the removed one.
+ *
+ * @details Unlinks the node in constant time, using the previous node remembered by the iterator.
+ *
+ * @warning The position must point to an element of this list, not to end().
+ */
+template <typename T>
+typename SLinkedList<T>::iterator SLinkedList<T>::erase(const_iterator position)
+{
+    SListNode<T>* deleteNode = position.node;
+    SListNode<T>* nextNode = deleteNode->next;
+    
+    if(position.previous == nullptr)    // Removing the head of list.
+        head = nextNode;
+    else
+        position.previous->next = nextNode;
+    
+    if(deleteNode == tail)
+        tail = position.previous;
+    
+    nodes.destroy(deleteNode);
+    listSize--;
+    return iterator(position.previous, nextNode);
+}
+
+/**
+ * @brief   Moves every element of another list to the end of this list.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The list whose elements will be moved. It is empty afterwards.
+ *
+ * @details The nodes of the other list are relinked in constant time, nothing is copied or allocated.
+ *          Both lists share one node pool afterwards.
+ *
+ * @note    If both lists already share their node pools with further lists, the nodes of the other
+ *          list have to be recreated in the node pool of this list first.
+ */
+template <typename T>
+void SLinkedList<T>::splice(SLinkedList<T>& other)
+{
+    if(this == &other || other.head == nullptr)
+        return;
+    
+    adoptNodes(other);
+    
+    if(head == nullptr)
+        head = other.head;
+    else
+        tail->next = other.head;
+    
+    tail = other.tail;
+    listSize += other.listSize;
+    
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.listSize = 0;
+}
+
+/**
+ * @brief   Moves a range of elements from another list into this list, right before the specified position.
+ *
+ * @tparam T        Any data type or class.
+ * @param position  Iterator to the element of this list before which the range is inserted. May be end().
+ * @param other     The list that holds the range. May be this list.
+ * @param first     Iterator to the first element of the range.
+ * @param last      Iterator past the last element of the range.
+ *
+ * @details The nodes of the range are relinked without being copied or allocated, which takes
+ *          time proportional to the length of the range to keep track of both list sizes.
+ *          Both lists share one node pool afterwards.
+ *
+ * @note    If both lists already share their node pools with further lists, the elements of the
+ *          range are moved into new nodes from the node pool of this list instead.
+ *
+ * @warning The position must not be inside the range.
+ */
+template <typename T>
+void SLinkedList<T>::splice(const_iterator position, SLinkedList<T>& other, const_iterator first, const_iterator last)
+{
+    if(first == last || (this == &other && position == last))
+        return;
+    
+    if(this != &other && !nodes.share(other.nodes))
+    {
+        // Move the range into a list of new nodes from this pool, then splice those nodes instead.
+        SLinkedList<T> temp(nodes.getPool());
+        for(iterator it(first.previous, first.node); it != last; it = other.erase(it))
+            temp.emplaceLast(std::move(*it));
+        
+        splice(position, temp, temp.cbegin(), temp.cend());
+        return;
+    }
+    
+    SListNode<T>* rangeFirst = first.node;
+    SListNode<T>* rangeLast = last.previous;
+    
+    if(this != &other)
+    {
+        int rangeSize = 1;
+        for(SListNode<T>* node = rangeFirst; node != rangeLast; node = node->next)
+            rangeSize++;
+        
+        other.listSize -= rangeSize;
+        listSize += rangeSize;
+    }
+    
+    // Unlink the range from the other list.
+    if(first.previous == nullptr)
+        other.head = last.node;
+    else
+        first.previous->next = last.node;
+    
+    if(rangeLast == other.tail)
+        other.tail = first.previous;
+    
+    // Link the range in before the position.
+    SListNode<T>* before = position.previous;
+    if(position.node == nullptr)        // Inserting at the end of this list.
+        before = tail;
+    
+    if(before == nullptr)
+    {
+        rangeLast->next = head;
+        head = rangeFirst;
+    }
+    else
+    {
+        rangeLast->next = before->next;
+        before->next = rangeFirst;
+    }
+    
+    if(rangeLast->next == nullptr)
+        tail = rangeLast;
+}
+
+/**
+ * @brief   Splits the list in two at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index of the first element that is moved into the returned list.
+ * @return      A list with the elements from the index to the end of this list.
+ *
+ * @details This list keeps the elements before the index. The nodes are relinked, not copied,
+ *          and the returned list shares the node pool of this list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the index is out of range when function is called.
+ *          The index may be equal to the size of the list, in which case the returned list is empty.
+ */
+template <typename T>
+SLinkedList<T> SLinkedList<T>::splitAt(const int index)
+{
+    if(index < 0 || index > listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    SLinkedList<T> splitList(nodes.getPool());
+    if(index == listSize)
+        return splitList;
+    
+    splitList.tail = tail;
+    splitList.listSize = listSize - index;
+    
+    if(index == 0)
+    {
+        splitList.head = head;
+        head = nullptr;
+        tail = nullptr;
+    }
+    else
+    {
+        SListNode<T>* newTail = nodeAt(index-1);
+        splitList.head = newTail->next;
+        newTail->next = nullptr;
+        tail = newTail;
+    }
+    
+    listSize = index;
+    return splitList;
+}
+
+/**
+ * @brief   Merges another sorted list into this sorted list.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The sorted list whose elements will be merged. It is empty afterwards.
+ *
+ * @details Both lists must be sorted in ascending order using operator<. The merge is stable,
+ *          equal elements of this list stay in front of the ones from the other list.
+ *          The nodes are relinked, nothing is copied or allocated.
+ *
+ * @note    If both lists already share their node pools with further lists, the nodes of the other
+ *          list have to be recreated in the node pool of this list first.
+ */
+template <typename T>
+void SLinkedList<T>::merge(SLinkedList<T>& other)
+{
+    merge(other, std::less<T>());
+}
+
+/**
+ * @brief   Merges another sorted list into this sorted list using a custom comparison.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param other     The sorted list whose elements will be merged. It is empty afterwards.
+ * @param compare   The comparison both lists are sorted by.
+ *
+ * @details The merge is stable, equal elements of this list stay in front of the ones from the
+ *          other list. The nodes are relinked, nothing is copied or allocated.
+ */
+template <typename T>
+template <typename Compare>
+void SLinkedList<T>::merge(SLinkedList<T>& other, Compare compare)
+{
+    if(this == &other || other.head == nullptr)
+        return;
+    
+    adoptNodes(other);
+    
+    SListNode<T>* current = head;
+    SListNode<T>* otherCurrent = other.head;
+    SListNode<T>** link = &head;     // The next pointer that receives the next merged node.
+    while(current != nullptr && otherCurrent != nullptr)
+    {
+        if(compare(otherCurrent->data, current->data))
+        {
+            *link = otherCurrent;
+            otherCurrent = otherCurrent->next;
+        }
+        else
+        {
+            *link = current;
+            current = current->next;
+        }
+        link = &(*link)->next;
+    }
+    
+    if(current == nullptr)      // The rest of the other list ends the merged list.
+    {
+        *link = otherCurrent;
+        tail = other.tail;
+    }
+    else
+        *link = current;
+    
+    listSize += other.listSize;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.listSize = 0;
+}
+
+/**
+ * @brief   Sorts the list in ascending order using operator<.
+ *
+ * @tparam T        Any data type or class.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details See sort(Compare, const ExecutionPolicy&).
+ */
+template <typename T>
+void SLinkedList<T>::sort(const ExecutionPolicy& policy)
+{
+    sort(std::less<T>(), policy);
+}
+
+/**
+ * @brief   Sorts the list using a custom comparison.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Compare  A callable that takes two elements and returns true if the first goes before the second.
+ * @param compare   The comparison to sort by.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details A stable merge sort that relinks the nodes in O(n log n) time, nothing is copied or allocated.
+ *          A parallel policy sorts one segment of the list per thread and merges the sorted segments.
+ *          See sortChain().
+ *
+ * @note    If the comparison throws, every element is still in the list, in an unspecified order.
+ */
+template <typename T>
+template <typename Compare>
+void SLinkedList<T>::sort(Compare compare, const ExecutionPolicy& policy)
+{
+    try
+    {
+        sortChain(head, listSize, compare, policy);
+    }
+    catch(...)
+    {
+        relinkTail();
+        throw;
+    }
+    relinkTail();
+}
+
+/**
+ * @brief   Calls a function on every element of the list.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a reference to an element.
+ * @param visit     The function.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details Visits the elements from head to tail. A parallel policy visits one segment of the list
+ *          per thread instead, each with its own copy of the function.
+ */
+template <typename T>
+template <typename Function>
+void SLinkedList<T>::forEach(Function visit, const ExecutionPolicy& policy)
+{
+    forEachInChain(head, listSize, visit, policy);
+}
+
+/**
+ * @brief   Replaces every element of the list with the result of a function.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes an element and returns its replacement.
+ * @param function  The function.
+ * @param policy    The execution policy, sequential by default.
+ *
+ * @details Works like forEach(), assigning the result of the function to every element.
+ */
+template <typename T>
+template <typename Function>
+void SLinkedList<T>::transform(Function function, const ExecutionPolicy& policy)
+{
+    forEachInChain(head, listSize, [function](T& data) mutable { data = function(data); }, policy);
+}
+
+/**
+ * @brief   Combines every element of the list into one result.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Result   The type of the result.
+ * @tparam Combine  A callable that combines any mix of a Result and an element into a Result.
+ * @param init      The value the result starts from.
+ * @param combine   The combination.
+ * @param policy    The execution policy, sequential by default.
+ * @return          The combination of init and every element.
+ *
+ * @details Combines the elements from head to tail. A parallel policy combines one segment of the
+ *          list per thread and then the segment results, so the combination must be associative
+ *          and commutative, like for std::reduce(). See reduceChain().
+ */
+template <typename T>
+template <typename Result, typename Combine>
+Result SLinkedList<T>::reduce(Result init, Combine combine, const ExecutionPolicy& policy) const
+{
+    return reduceChain(head, listSize, std::move(init), combine, policy);
+}
+
+/**
+ * @brief   Combines every element of the list into a result of another type.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Result       The type of the result.
+ * @tparam Accumulate   A callable that adds an element to a Result and returns the new Result.
+ * @tparam Combine      A callable that combines two Results into one.
+ * @param identity      The value the result starts from, which combine() must leave unchanged, like 0 for a sum.
+ * @param accumulate    The accumulation.
+ * @param combine       The combination of two results.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The accumulation of every element onto identity.
+ *
+ * @details Accumulates the elements from head to tail. A parallel policy accumulates one segment of
+ *          the list per thread, each starting from identity, and combines the segment results in
+ *          order, so the combination must be associative. See reduceChain().
+ */
+template <typename T>
+template <typename Result, typename Accumulate, typename Combine>
+Result SLinkedList<T>::reduce(Result identity, Accumulate accumulate, Combine combine, const ExecutionPolicy& policy) const
+{
+    return reduceChain(head, listSize, std::move(identity), accumulate, combine, policy);
+}
+
+/**
+ * @brief   Returns an iterator to the first element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it matches.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              An iterator to the first matching element, or end() if none matches.
+ *
+ * @details A parallel policy searches one segment of the list per thread. Every thread stops at its
+ *          first match or as soon as an earlier segment found one, and the earliest match is returned.
+ *          The iterator needs the element before the match, which takes a second walk up to the match.
+ */
+template <typename T>
+template <typename Predicate>
+typename SLinkedList<T>::iterator SLinkedList<T>::findIf(Predicate predicate, const ExecutionPolicy& policy)
+{
+    SListNode<T>* match = findInChain(head, listSize, predicate, policy);
+    SListNode<T>* previous = nullptr;
+    if(match != nullptr && match != head)
+        for(previous = head; previous->next != match; previous = previous->next) {}
+    
+    return iterator(previous, match);
+}
+
+/**
+ * @brief   Returns a constant iterator to the first element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it matches.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              A constant iterator to the first matching element, or end() if none matches.
+ *
+ * @details See findIf(Predicate, const ExecutionPolicy&).
+ */
+template <typename T>
+template <typename Predicate>
+typename SLinkedList<T>::const_iterator SLinkedList<T>::findIf(Predicate predicate, const ExecutionPolicy& policy) const
+{
+    SListNode<T>* match = findInChain(head, listSize, predicate, policy);
+    SListNode<T>* previous = nullptr;
+    if(match != nullptr && match != head)
+        for(previous = head; previous->next != match; previous = previous->next) {}
+    
+    return const_iterator(previous, match);
+}
+
+/**
+ * @brief   Removes every element of the list that matches a predicate.
+ *
+ * @tparam T            Any data type or class.
+ * @tparam Predicate    A callable that takes an element and returns true if it should be removed.
+ * @param predicate     The predicate.
+ * @param policy        The execution policy, sequential by default.
+ * @return              The number of removed elements.
+ *
+ * @details Tests and unlinks the elements in one pass from head to tail. A parallel policy tests one
+ *          segment of the list per thread first, and then unlinks the matching elements on the
+ *          calling thread, because the node pool is not thread safe.
+ */
+template <typename T>
+template <typename Predicate>
+int SLinkedList<T>::removeIf(Predicate predicate, const ExecutionPolicy& policy)
+{
+    bool parallel = (policy.segmentsFor(listSize) > 1);
+    std::vector<char> matches;
+    if(parallel)
+        matches = matchChain(head, listSize, predicate, policy);
+    
+    int removed = 0;
+    SListNode<T>* previous = nullptr;
+    SListNode<T>** link = &head;    // The next pointer that points at the node being tested.
+    for(int index = 0; *link != nullptr; index++)
+    {
+        SListNode<T>* node = *link;
+        if(parallel ? !matches[index] : !predicate(node->data))
+        {
+            previous = node;
+            link = &node->next;
+            continue;
+        }
         
-        deleteNode = temp->next;
-        temp->next = deleteNode->next;
+        *link = node->next;
+        if(node == tail)            // Removing the tail of list.
+            tail = previous;
+        
+        nodes.destroy(node);
+        listSize--;
+        removed++;
     }
     
-    deleteNode->next = nullptr;
-    delete deleteNode;
-    listSize--;
+    return removed;
 }
 
 /**
- * @brief   Clears the entire list recursively and resets all field elements to default.
+ * @brief   Clears the entire list and resets all field elements to default.
  *
  * @tparam T    Any data type or class.
+ *
+ * @details Walks the list iteratively, so it never needs more than constant stack space.
+ *          If this list is the only user of its node pool, the whole pool is released slab by slab
+ *          instead of node by node, and the walk is skipped entirely when the data is trivially
+ *          destructible. Otherwise every node is given back to the shared pool for reuse.
  */
 template <typename T>
 void SLinkedList<T>::clear()
 {
-    delete head;
+    nodes.destroyChain(head, &SListNode<T>::next);
+    
     head = nullptr;
     tail = nullptr;
     listSize = 0;
 }
 
+/**
+ * @brief   Replaces the contents of the list with the elements of a range.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Builds the list in one pass over the range. When the size of the range
+ *          can be counted up front, every node is reserved from the node pool with a single allocation.
+ *
+ * @warning The range must not point into this list.
+ */
+template <typename T>
+template <typename InputIterator>
+void SLinkedList<T>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    
+    int count = rangeSize(first, last);
+    nodes.reserve(count);
+    
+    for(; first != last; ++first)
+        emplaceLast(*first);
+}
+
 /**
  * @brief   Removes and returns the head of the list.
  *
  * @tparam T    Any data type or class.
  * @return      The removed data.
  *
+ * @details The data is moved out of the removed node, not copied.
+ *
  * @throw   std::out_of_range
  * @warning Throws an Out Of Range exception if the list is empty when function is called.
  */
@@ -328,14 +1160,13 @@ T SLinkedList<T>::pop()
     if(head == nullptr)
         throw std::out_of_range("Linked List is Empty");
     
-    Node<T>* deleteNode = head;
-    T popped_data = head->data;
+    SListNode<T>* deleteNode = head;
+    T popped_data = std::move(head->data);
     head = head->next;
     if(head == nullptr) // If list is empty, make sure tail is set to nullptr.
         tail = nullptr;
     
-    deleteNode->next = nullptr;
-    delete deleteNode;
+    nodes.destroy(deleteNode);
     listSize--;
     
     return popped_data;
@@ -348,6 +1179,8 @@ T SLinkedList<T>::pop()
  * @param index Index at which to retrieve and remove data from the list.
  * @return      The removed data.
  *
+ * @details The data is moved out of the removed node, not copied.
+ *
  * @throw   std::out_of_range
  * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
  */
@@ -359,7 +1192,7 @@ T SLinkedList<T>::pop(const int index)
     else if(index < 0 || index >= listSize)
         throw std::out_of_range("Index is out of range.");
     
-    Node<T>* deleteNode = head;
+    SListNode<T>* deleteNode = head;
     
     if(index == 0)  // Pop the head of list.
     {
@@ -369,7 +1202,7 @@ T SLinkedList<T>::pop(const int index)
     }
     else if(index == listSize-1)    // Pop the tail of list.
     {
-        Node<T>* temp = head;
+        SListNode<T>* temp = head;
         for(int i = 1; i < listSize-1; i++)
             temp = temp->next;
         
@@ -379,7 +1212,7 @@ T SLinkedList<T>::pop(const int index)
     }
     else
     {
-        Node<T>* temp = head;
+        SListNode<T>* temp = head;
         for(int i = 1; i < index; i++)
             temp = temp->next;
         
@@ -387,25 +1220,62 @@ T SLinkedList<T>::pop(const int index)
         temp->next = deleteNode->next;
     }
     
-    T popped_data = deleteNode->data;
-    deleteNode->next = nullptr;
-    delete deleteNode;
+    T popped_data = std::move(deleteNode->data);
+    nodes.destroy(deleteNode);
     listSize--;
     
     return popped_data;
 }
 
+/**
+ * @brief   Removes the head of the list and moves it into the provided variable.
+ *
+ * @tparam T    Any data type or class.
+ * @param out   The variable that receives the removed data.
+ * @return      True if data was removed, false if the list is empty.
+ *
+ * @details Works like pop() but reports an empty list through the return value instead of throwing.
+ */
+template <typename T>
+bool SLinkedList<T>::tryPop(T& out)
+{
+    if(head == nullptr)
+        return false;
+    
+    out = std::move(head->data);
+    remove(0);
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T>
+T& SLinkedList<T>::peek()
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return head->data;
+}
+
 /**
  * @brief   Returns, but does not remove, the head of the list.
  *
  * @tparam T    Any data type or class.
- * @return      The data located at the head of the list.
+ * @return      A constant reference to the data located at the head of the list.
  *
  * @throw   std::out_of_range
  * @warning Throws an Out Of Range exception if the list is empty when function is called.
  */
 template <typename T>
-T SLinkedList<T>::peek()
+const T& SLinkedList<T>::peek() const
 {
     if(head == nullptr)
         throw std::out_of_range("Linked List is Empty");
@@ -418,29 +1288,41 @@ T SLinkedList<T>::peek()
  *
  * @tparam T    Any data type or class.
  * @param index Index at which to retrieve data from the list.
- * @return      The data located at the specified index of the list.
+ * @return      A reference to the data located at the specified index of the list.
  *
  * @throw   std::out_of_range
  * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
  */
 template <typename T>
-T SLinkedList<T>::peek(const int index)
+T& SLinkedList<T>::peek(const int index)
 {
     if(head == nullptr)
         throw std::out_of_range("Linked List is Empty");
     else if(index < 0 || index >= listSize)
         throw std::out_of_range("Index is out of range.");
-    else if(index == 0)
-        return head->data;
-    else if(index == listSize-1)
-        return tail->data;
-    else
-    {
-        Node<T>* temp = head;
-        for(int i = 0; i < index; i++)
-            temp = temp->next;
-        return temp->data;
-    }
+    
+    return nodeAt(index)->data;
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index at which to retrieve data from the list.
+ * @return      A constant reference to the data located at the specified index of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T>
+const T& SLinkedList<T>::peek(const int index) const
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    return nodeAt(index)->data;
 }
 
 /**
@@ -450,7 +1332,7 @@ T SLinkedList<T>::peek(const int index)
  * @return      The size of the list.
  */
 template <typename T>
-int SLinkedList<T>::size()
+int SLinkedList<T>::size() const
 {
     return listSize;
 }
@@ -462,11 +1344,335 @@ int SLinkedList<T>::size()
  * @return      A boolean flag.
  */
 template <typename T>
-bool SLinkedList<T>::empty()
+bool SLinkedList<T>::empty() const
 {
     return listSize == 0;
 }
 
+/**
+ * @brief   Returns the node pool used by this list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The shared node pool.
+ *
+ * @details The returned pool can be passed to the Shared Pool Constructor of another list
+ *          so both lists allocate from, and recycle into, the same pool.
+ */
+template <typename T>
+std::shared_ptr<NodePool<SListNode<T>>> SLinkedList<T>::getPool()
+{
+    return nodes.getPool();
+}
+
+#if defined(DATASTRUCTURES_STATS)
+/**
+ * @brief   Returns the statistics of this list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The statistics, with the bytes held brought up to date.
+ *
+ * @details Counts the nodes allocated and freed and the bytes held by the nodes. For operator[],
+ *          insert() and remove() it also counts the calls, the nodes stepped over to reach the
+ *          index, and the latencies.
+ *
+ * @note    Only available when DATASTRUCTURES_STATS is defined.
+ */
+template <typename T>
+const ContainerStats& SLinkedList<T>::stats()
+{
+    ContainerStats& listStats = nodes.getStats();
+    listStats.recordBytesHeld((long long)listSize * sizeof(SListNode<T>));
+    return listStats;
+}
+#endif
+
+/**
+ * @brief   Writes the list to a stream in the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then every element from head to tail with ElementCodec<T>,
+ *          iteratively, so a list of any length can be written. Read it back with deserialize().
+ */
+template <typename T>
+void SLinkedList<T>::serialize(std::ostream& output) const
+{
+    writeSerialHeader(output, SERIAL_MAGIC, SERIAL_SINGLY_LINKED_LIST, 0, ElementCodec<T>::SIZE, (std::uint64_t)listSize);
+    for(const SListNode<T>* node = head; node != nullptr; node = node->next)
+        ElementCodec<T>::write(output, node->data);
+}
+
+/**
+ * @brief   Replaces the contents of the list with a list read from the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param input     The input stream, opened in binary mode, at data written by serialize().
+ *
+ * @details The elements are read into a new list that allocates from the node pool of this list,
+ *          which then takes the place of this list. If anything goes wrong, this list is unchanged.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serialize() of a Singly Linked List
+ *          with the same element type, or if the input ends early.
+ */
+template <typename T>
+void SLinkedList<T>::deserialize(std::istream& input)
+{
+    SerialHeader header = readSerialHeader(input, SERIAL_SINGLY_LINKED_LIST, ElementCodec<T>::SIZE);
+    SLinkedList<T> temp(nodes.getPool());
+    for(std::uint64_t i = 0; i < header.count; i++)
+        temp.emplaceLast(ElementCodec<T>::read(input));
+    
+    swap(temp);
+}
+
+/**
+ * @brief   Writes the list to a stream in the flat binary format.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then the raw elements from head to tail, aligned for T, so the
+ *          written file can be memory mapped and used in place through a FlatView, or loaded again
+ *          with deserializeFlat().
+ */
+template <typename T>
+void SLinkedList<T>::serializeFlat(std::ostream& output) const
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The flat format needs a trivially copyable element type");
+    
+    writeSerialHeader(output, FLAT_MAGIC, SERIAL_SINGLY_LINKED_LIST, 0, sizeof(T), (std::uint64_t)listSize, alignof(T));
+    for(const SListNode<T>* node = head; node != nullptr; node = node->next)
+        output.write(reinterpret_cast<const char*>(&node->data), sizeof(T));
+}
+
+/**
+ * @brief   Replaces the contents of the list with the elements of data in the flat binary format.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param data      The start of data written by serializeFlat(), for example a memory mapped file.
+ * @param bytes     The size of the data.
+ *
+ * @details Nothing is parsed, the elements are copied straight out of the data with assign(),
+ *          which reserves every node with a single allocation.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serializeFlat() of a Singly Linked List
+ *          with the same element type, or if it is truncated or misaligned. This list is unchanged then.
+ */
+template <typename T>
+void SLinkedList<T>::deserializeFlat(const void* data, const std::size_t bytes)
+{
+    FlatView<T> view(data, bytes, SERIAL_SINGLY_LINKED_LIST);
+    assign(view.begin(), view.end());
+}
+
+/**
+ * @brief   Writes every element of the list to a sink, from head to tail.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Sink     Any type with a write(const char* data, std::size_t size) function, like std::ostream,
+ *                  StringSink, BufferSink or FileDescriptorSink.
+ * @param sink      The sink the elements are written to.
+ * @param separator The text written between two elements.
+ *
+ * @details Walks the list iteratively and formats the elements through a BufferedWriter, so a list of
+ *          any length is written with constant stack space and a single chunk of memory. When the sink
+ *          is a stream, the elements are formatted with the formatting of the stream.
+ */
+template <typename T>
+template <typename Sink>
+void SLinkedList<T>::writeTo(Sink& sink, const char* separator) const
+{
+    BufferedWriter<Sink> writer(sink, formatOf(sink));
+    for(const SListNode<T>* node = head; node != nullptr; node = node->next)
+    {
+        if(node != head)
+            writer.write(separator);
+        writer.writeElement(node->data);
+    }
+    
+    writer.flush();
+}
+
+/**
+ * @brief   Returns an iterator to the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      An iterator to the first element, or end() if the list is empty.
+ */
+template <typename T>
+typename SLinkedList<T>::iterator SLinkedList<T>::begin()
+{
+    return iterator(nullptr, head);
+}
+
+/**
+ * @brief   Returns a constant iterator to the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant iterator to the first element, or end() if the list is empty.
+ */
+template <typename T>
+typename SLinkedList<T>::const_iterator SLinkedList<T>::begin() const
+{
+    return const_iterator(nullptr, head);
+}
+
+/**
+ * @brief   Returns a constant iterator to the head of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant iterator to the first element, or cend() if the list is empty.
+ */
+template <typename T>
+typename SLinkedList<T>::const_iterator SLinkedList<T>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief   Returns an iterator past the tail of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      An iterator past the last element.
+ */
+template <typename T>
+typename SLinkedList<T>::iterator SLinkedList<T>::end()
+{
+    return iterator(tail, nullptr);
+}
+
+/**
+ * @brief   Returns a constant iterator past the tail of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant iterator past the last element.
+ */
+template <typename T>
+typename SLinkedList<T>::const_iterator SLinkedList<T>::end() const
+{
+    return const_iterator(tail, nullptr);
+}
+
+/**
+ * @brief   Returns a constant iterator past the tail of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant iterator past the last element.
+ */
+template <typename T>
+typename SLinkedList<T>::const_iterator SLinkedList<T>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief   Copies the elements of another list into this list.
+ *
+ * @tparam T        Any data type or class.
+ * @param copyList  The list whose elements will be copied into this list object.
+ *
+ * @details The nodes this list already has are reused in place. Extra nodes are destroyed,
+ *          and the missing nodes are reserved from the node pool with a single allocation.
+ */
+template <typename T>
+void SLinkedList<T>::copyFrom(const SLinkedList<T>& copyList)
+{
+    SListNode<T>** currentNode = &head;
+    SListNode<T>* lastNode = nullptr;
+    const SListNode<T>* copyNode = copyList.head;
+    int copied = 0;
+    for(; *currentNode != nullptr && copyNode != nullptr; copyNode = copyNode->next)
+    {
+        (*currentNode)->data = copyNode->data;
+        lastNode = *currentNode;
+        currentNode = &(*currentNode)->next;
+        copied++;
+    }
+    
+    // This list was longer, destroy the nodes past the copied ones.
+    SListNode<T>* extraNode = *currentNode;
+    *currentNode = nullptr;
+    while(extraNode != nullptr)
+    {
+        SListNode<T>* nextNode = extraNode->next;
+        nodes.destroy(extraNode);
+        extraNode = nextNode;
+    }
+    tail = lastNode;
+    listSize = copied;
+    
+    // This list was shorter, append the rest.
+    nodes.reserve(copyList.listSize - copied);
+    for(; copyNode != nullptr; copyNode = copyNode->next)
+    {
+        (*currentNode) = nodes.create(copyNode->data);
+        tail = *currentNode;
+        currentNode = &(*currentNode)->next;
+        listSize++;
+    }
+}
+
+/**
+ * @brief   Returns the node located at the specified index of the list.
+ *
+ * @tparam T    Any data type or class.
+ * @param index Index of the node. Must be within range of the list.
+ * @return      The node located at the specified index.
+ */
+template <typename T>
+SListNode<T>* SLinkedList<T>::nodeAt(const int index) const
+{
+    if(index == listSize-1)
+        return tail;
+    
+    SListNode<T>* temp = head;
+    for(int i = 0; i < index; i++)
+        temp = temp->next;
+    
+    return temp;
+}
+
+/**
+ * @brief   Sets the tail from the next pointers.
+ *
+ * @tparam T    Any data type or class.
+ *
+ * @details Used after sort() rearranged the next pointers.
+ */
+template <typename T>
+void SLinkedList<T>::relinkTail()
+{
+    tail = nullptr;
+    for(SListNode<T>* node = head; node != nullptr; node = node->next)
+        tail = node;
+}
+
+/**
+ * @brief   Makes sure that every node of another list belongs to the node pool of this list.
+ *
+ * @tparam T    Any data type or class.
+ * @param other The other linked list.
+ *
+ * @details Shares the node pools in place when possible. Otherwise the elements of the other list
+ *          are moved into new nodes from the node pool of this list.
+ */
+template <typename T>
+void SLinkedList<T>::adoptNodes(SLinkedList<T>& other)
+{
+    if(nodes.share(other.nodes))
+        return;
+    
+    SLinkedList<T> temp(nodes.getPool());
+    for(SListNode<T>* node = other.head; node; node = node->next)
+        temp.emplaceLast(std::move(node->data));
+    
+    other.clear();
+    other.swap(temp);
+}
+
 /**
  * @brief   Swaps Linked Lists.
  *
@@ -476,8 +1682,8 @@ bool SLinkedList<T>::empty()
 template <typename T>
 void SLinkedList<T>::swap(SLinkedList<T>& other)
 {
-    Node<T>* tempHead = head;
-    Node<T>* tempTail = tail;
+    SListNode<T>* tempHead = head;
+    SListNode<T>* tempTail = tail;
     head = other.head;
     tail = other.tail;
     other.head = tempHead;
@@ -486,6 +1692,8 @@ void SLinkedList<T>::swap(SLinkedList<T>& other)
     int tempSize = listSize;
     listSize = other.listSize;
     other.listSize = tempSize;
+    
+    nodes.swap(other.nodes);
 }
 
 
@@ -511,16 +1719,12 @@ T& SLinkedList<T>::operator[](const int index)
         throw std::out_of_range("Linked List is Empty");
     else if(index < 0 || index >= listSize)
         throw std::out_of_range("Index is out of range.");
-    else if(index == 0)
-        return head->data;
-    else if(index == listSize-1)
-        return tail->data;
-    
-    Node<T>* temp = head;
-    for(int i = 0; i < index; i++)
-        temp = temp->next;
-    
-    return temp->data;
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::SUBSCRIPT);
+    nodes.getStats().recordTraversal(ContainerStats::SUBSCRIPT, (index == listSize-1) ? 0 : index);
+#endif
+
+    return nodeAt(index)->data;
 }
 
 /**
@@ -544,8 +1748,8 @@ bool SLinkedList<T>::operator==(const SLinkedList& compareList)
         return false;
     else
     {
-        Node<T>* currentNode = head;
-        Node<T>* compareNode = compareList.head;
+        SListNode<T>* currentNode = head;
+        SListNode<T>* compareNode = compareList.head;
         while(currentNode != nullptr && compareNode != nullptr)
         {
             if(currentNode->data != compareNode->data)
@@ -566,13 +1770,16 @@ bool SLinkedList<T>::operator==(const SLinkedList& compareList)
  * @param copyList  The linked list object from which to copy elements.
  * @return          A reference to a copied linked list object.
  *
- * @details Copies a linked list with the help of the copy constructor and a custom swap function.
+ * @details Overwrites the elements of the nodes this list already has and only creates,
+ *          or destroys, the nodes that make up the difference in size. If copying an element throws,
+ *          this list is left valid but only partly copied.
  */
 template <typename T>
 SLinkedList<T>& SLinkedList<T>::operator=(const SLinkedList& copyList)
 {
-    SLinkedList<T> tempList(copyList);
-    tempList.swap(*this);
+    if(this != &copyList)
+        copyFrom(copyList);
+    
     return *this;
 }
 
@@ -589,7 +1796,7 @@ SLinkedList<T>& SLinkedList<T>::operator=(const SLinkedList& copyList)
  * @note    std::move() needs to be used to call this operator.
  */
 template <typename T>
-SLinkedList<T>& SLinkedList<T>::operator=(SLinkedList&& moveList)
+SLinkedList<T>& SLinkedList<T>::operator=(SLinkedList&& moveList) noexcept
 {
     if(this == &moveList)   // Make this and moveList are not the same object.
         return *this;
@@ -610,7 +1817,8 @@ SLinkedList<T>& SLinkedList<T>::operator=(SLinkedList&& moveList)
  * @param output    The output stream (usually std::cout).
  * @param list      The linked list object that will be printed.
  *
- * @details Prints the list elements to the specified output stream.
+ * @details Prints the list elements to the specified output stream, with writeTo(), so the
+ *          list is walked iteratively and written in buffered chunks.
  *
  * @note    Any class or data type used with this linked list class MUST implement its
  *          own operator<< in order for this operator<< to work correctly. All primitive
@@ -621,8 +1829,11 @@ SLinkedList<T>& SLinkedList<T>::operator=(SLinkedList&& moveList)
 template <typename T>
 std::ostream& operator<<(std::ostream& output, const SLinkedList<T>& list)
 {
-    if (list.head)
-        return output << "(" << *list.head << ")";
-    else
-        return output << "()";
+    output << "(";
+    list.writeTo(output);
+    return output << ")";
 }
+
+} // namespace DataStructures
+
+#endif /* SLinkedList_hpp */
@@ -0,0 +1,384 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    Serialization.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The binary formats that the node based data structures are serialized to and loaded from.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef Serialization_hpp
+#define Serialization_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+namespace DataStructures
+{
+
+/**
+ * @struct  SerialHeader
+ * @brief   The header that starts both binary formats.
+ * @details Every field is stored in the byte order of the machine that wrote it. A file written with
+ *          the other byte order is rejected, because its magic number reads differently.
+ */
+struct SerialHeader
+{
+    std::uint32_t magic;        /**< SERIAL_MAGIC for the streamed format, FLAT_MAGIC for the flat format. */
+    std::uint32_t version;      /**< The version of the format, SERIAL_VERSION. */
+    std::uint32_t container;    /**< The SerialContainer that wrote the data. */
+    std::uint32_t flags;        /**< SERIAL_INVERTED for an inverted Binary Tree, otherwise 0. */
+    std::uint64_t elementSize;  /**< The size of a raw element, or 0 when the elements are encoded one by one. */
+    std::uint64_t count;        /**< The number of elements. */
+    std::uint64_t dataOffset;   /**< The offset of the first element from the start of the header. */
+};
+
+/** The data structures that write the binary formats. */
+enum SerialContainer
+{
+    SERIAL_SINGLY_LINKED_LIST = 1,  /**< SLinkedList, elements from head to tail. */
+    SERIAL_DOUBLY_LINKED_LIST = 2,  /**< DLinkedList, elements from head to tail. */
+    SERIAL_STACK = 3,               /**< Stack, elements from top to bottom. */
+    SERIAL_BINARY_TREE = 4          /**< BinaryTree, elements in level order, as if the tree was never inverted. */
+};
+
+// ----------- CONSTANTS ------------
+const std::uint32_t SERIAL_MAGIC = 0x4E425344;  /**< "DSBN", starts the streamed format. */
+const std::uint32_t FLAT_MAGIC = 0x54464C44;    /**< "DLFT", starts the flat format. */
+const std::uint32_t SERIAL_VERSION = 1;         /**< The version of both formats. */
+const std::uint32_t SERIAL_INVERTED = 1;        /**< The flag of an inverted Binary Tree. */
+const std::size_t SERIAL_READ_CHUNK = 1 << 16;  /**< The most elements or characters allocated ahead of reading them. */
+
+/**
+ * @struct  ElementCodec
+ * @brief   Writes a single element to, and reads it back from, the streamed binary format.
+ * @details Defined for every trivially copyable type, which is stored as its raw bytes, and for
+ *          std::basic_string, which is stored as its length followed by its characters.
+ *          Serialize any other element type by specializing ElementCodec for it, with the same
+ *          static SIZE constant and write() and read() functions.
+ * @tparam T        The element type.
+ * @tparam Enable   Selects a specialization, always void.
+ */
+template <typename T, typename Enable = void>
+struct ElementCodec;
+
+/**
+ * @struct  ElementCodec
+ * @brief   Stores a trivially copyable element as its raw bytes.
+ * @tparam T    A trivially copyable and default constructible type.
+ */
+template <typename T>
+struct ElementCodec<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+{
+    static const std::uint64_t SIZE = sizeof(T);    /**< Every element takes sizeof(T) bytes. */
+    
+    /** Writes the raw bytes of the element. */
+    static void write(std::ostream& output, const T& element)
+    {
+        output.write(reinterpret_cast<const char*>(&element), sizeof(T));
+    }
+    
+    /** Reads the raw bytes of an element, throws std::runtime_error if the input ends first. */
+    static T read(std::istream& input)
+    {
+        T element;
+        if(!input.read(reinterpret_cast<char*>(&element), sizeof(T)))
+            throw std::runtime_error("Serialized data is truncated");
+        
+        return element;
+    }
+};
+
+/**
+ * @struct  ElementCodec
+ * @brief   Stores a string as its length followed by its characters.
+ * @tparam Char         A trivially copyable character type.
+ * @tparam Traits       The character traits of the string.
+ * @tparam Allocator    The allocator of the string.
+ */
+template <typename Char, typename Traits, typename Allocator>
+struct ElementCodec<std::basic_string<Char, Traits, Allocator>, typename std::enable_if<std::is_trivially_copyable<Char>::value>::type>
+{
+    static const std::uint64_t SIZE = 0;    /**< The elements have different sizes. */
+    
+    /** Writes the length and the characters of the string. */
+    static void write(std::ostream& output, const std::basic_string<Char, Traits, Allocator>& element)
+    {
+        std::uint64_t length = element.size();
+        output.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        output.write(reinterpret_cast<const char*>(element.data()), (std::streamsize)(length * sizeof(Char)));
+    }
+    
+    /** Reads the length and then the characters of a string in chunks, throws std::runtime_error if the input ends first. */
+    static std::basic_string<Char, Traits, Allocator> read(std::istream& input)
+    {
+        std::uint64_t length;
+        if(!input.read(reinterpret_cast<char*>(&length), sizeof(length)))
+            throw std::runtime_error("Serialized data is truncated");
+        
+        std::basic_string<Char, Traits, Allocator> element;
+        for(std::uint64_t remaining = length; remaining > 0;)
+        {
+            std::size_t chunk = (remaining < SERIAL_READ_CHUNK) ? (std::size_t)remaining : SERIAL_READ_CHUNK;
+            std::size_t start = element.size();
+            element.resize(start + chunk);
+            if(!input.read(reinterpret_cast<char*>(&element[start]), (std::streamsize)(chunk * sizeof(Char))))
+                throw std::runtime_error("Serialized data is truncated");
+            remaining -= chunk;
+        }
+        
+        return element;
+    }
+};
+
+/**
+ * @brief   Writes the header of either binary format.
+ *
+ * @param output        The output stream, opened in binary mode.
+ * @param magic         SERIAL_MAGIC or FLAT_MAGIC.
+ * @param container     The data structure that writes the data.
+ * @param flags         SERIAL_INVERTED for an inverted Binary Tree, otherwise 0.
+ * @param elementSize   The size of a raw element, or 0 when the elements are encoded one by one.
+ * @param count         The number of elements.
+ * @param alignment     The alignment of the first element. Zero bytes are written after the header up to it.
+ */
+inline void writeSerialHeader(std::ostream& output, const std::uint32_t magic, const SerialContainer container, const std::uint32_t flags,
+                              const std::uint64_t elementSize, const std::uint64_t count, const std::size_t alignment = 1)
+{
+    std::size_t dataOffset = (sizeof(SerialHeader) + alignment - 1) / alignment * alignment;
+    SerialHeader header = {magic, SERIAL_VERSION, (std::uint32_t)container, flags, elementSize, count, dataOffset};
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for(std::size_t padding = sizeof(header); padding < dataOffset; padding++)
+        output.put('\0');
+}
+
+/**
+ * @brief   Checks a header of either binary format.
+ *
+ * @param header        The header.
+ * @param magic         The magic number the header must start with.
+ * @param container     The data structure that must have written the data.
+ * @param elementSize   The size of a raw element, or 0 when the elements are encoded one by one.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the header does not match, or if the data holds more
+ *          elements than a data structure can.
+ */
+inline void checkSerialHeader(const SerialHeader& header, const std::uint32_t magic, const SerialContainer container, const std::uint64_t elementSize)
+{
+    if(header.magic != magic || header.version != SERIAL_VERSION || header.dataOffset < sizeof(SerialHeader))
+        throw std::runtime_error("Serialized data is invalid");
+    else if(header.container != (std::uint32_t)container)
+        throw std::runtime_error("Serialized data is from a different data structure");
+    else if(header.elementSize != elementSize)
+        throw std::runtime_error("Serialized data has a different element type");
+    else if(header.count > (std::uint64_t)INT32_MAX)
+        throw std::runtime_error("Serialized data has too many elements");
+}
+
+/**
+ * @brief   Reads and checks the header of the streamed binary format.
+ *
+ * @param input         The input stream, opened in binary mode.
+ * @param container     The data structure that must have written the data.
+ * @param elementSize   The size of a raw element, or 0 when the elements are encoded one by one.
+ * @return              The header. The input is left at the first element.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the input ends early or the header does not match.
+ */
+inline SerialHeader readSerialHeader(std::istream& input, const SerialContainer container, const std::uint64_t elementSize)
+{
+    SerialHeader header;
+    if(!input.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        throw std::runtime_error("Serialized data is truncated");
+    
+    checkSerialHeader(header, SERIAL_MAGIC, container, elementSize);
+    if(!input.ignore((std::streamsize)(header.dataOffset - sizeof(header))))
+        throw std::runtime_error("Serialized data is truncated");
+    
+    return header;
+}
+
+/**
+ * @class   FlatView
+ * @brief   A read-only view of data in the flat binary format, for example a memory mapped file.
+ * @details The flat format is a SerialHeader followed by the raw elements, aligned for T, in the order of
+ *          the data structure that wrote them. They are used in place, nothing is parsed or copied.
+ *          For a Binary Tree the elements are in level order, so the children of the element at position i
+ *          are at positions 2i+1 and 2i+2, the other way around when inverted() is true.
+ * @tparam T    A trivially copyable type.
+ *
+ * @note    The view does not own the data, which must stay valid as long as the view is used.
+ */
+template <typename T>
+class FlatView
+{
+public:
+    // -------------- TYPES -------------
+    typedef const T* const_iterator;
+    
+    // ---------- CONSTRUCTORS ----------
+    FlatView(const void* data, const std::size_t bytes, const SerialContainer container);
+    
+    // ----------- FUNCTIONS ------------
+    int size() const;
+    bool empty() const;
+    bool inverted() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    
+    // ----------- OPERATORS ------------
+    const T& operator[](const int index) const;
+    
+private:
+    // ------------- FIELDS -------------
+    const T* elements;  /**< The first element. */
+    int elementCount;   /**< The number of elements. */
+    bool isInverted;    /**< True if a Binary Tree was inverted when it was written. */
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Data Constructor.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param data      The start of the flat data.
+ * @param bytes     The size of the flat data.
+ * @param container The data structure that must have written the data.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the header does not match, if the data ends before the
+ *          last element, or if the elements are not aligned for T.
+ */
+template <typename T>
+FlatView<T>::FlatView(const void* data, const std::size_t bytes, const SerialContainer container)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The flat format needs a trivially copyable element type");
+    
+    SerialHeader header;
+    if(bytes < sizeof(header))
+        throw std::runtime_error("Serialized data is truncated");
+    
+    std::memcpy(&header, data, sizeof(header));
+    checkSerialHeader(header, FLAT_MAGIC, container, sizeof(T));
+    if(header.dataOffset > bytes || header.count > (bytes - header.dataOffset) / sizeof(T))
+        throw std::runtime_error("Serialized data is truncated");
+    
+    const unsigned char* first = static_cast<const unsigned char*>(data) + header.dataOffset;
+    if(reinterpret_cast<std::uintptr_t>(first) % alignof(T) != 0)
+        throw std::runtime_error("Serialized data is not aligned");
+    
+    elements = reinterpret_cast<const T*>(first);
+    elementCount = (int)header.count;
+    isInverted = (header.flags & SERIAL_INVERTED) != 0;
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Returns the number of elements.
+ *
+ * @tparam T    A trivially copyable type.
+ * @return      The number of elements.
+ */
+template <typename T>
+int FlatView<T>::size() const
+{
+    return elementCount;
+}
+
+/**
+ * @brief   Returns true if there are no elements and false otherwise.
+ *
+ * @tparam T    A trivially copyable type.
+ * @return      A boolean flag.
+ */
+template <typename T>
+bool FlatView<T>::empty() const
+{
+    return elementCount == 0;
+}
+
+/**
+ * @brief   Returns true if the data is from an inverted Binary Tree.
+ *
+ * @tparam T    A trivially copyable type.
+ * @return      A boolean flag.
+ */
+template <typename T>
+bool FlatView<T>::inverted() const
+{
+    return isInverted;
+}
+
+/**
+ * @brief   Returns a pointer to the first element.
+ *
+ * @tparam T    A trivially copyable type.
+ * @return      A pointer to the first element.
+ */
+template <typename T>
+typename FlatView<T>::const_iterator FlatView<T>::begin() const
+{
+    return elements;
+}
+
+/**
+ * @brief   Returns a pointer past the last element.
+ *
+ * @tparam T    A trivially copyable type.
+ * @return      A pointer past the last element.
+ */
+template <typename T>
+typename FlatView<T>::const_iterator FlatView<T>::end() const
+{
+    return elements + elementCount;
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Subscript operator.
+ *
+ * @tparam T    A trivially copyable type.
+ * @param index Index of the element.
+ * @return      The element located at the specified index.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the index is out of range when function is called.
+ */
+template <typename T>
+const T& FlatView<T>::operator[](const int index) const
+{
+    if(index < 0 || index >= elementCount)
+        throw std::out_of_range("Index is out of range.");
+    
+    return elements[index];
+}
+
+} // namespace DataStructures
+
+#endif /* Serialization_hpp */
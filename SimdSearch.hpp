@@ -0,0 +1,444 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    SimdSearch.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   Vectorized find and compare kernels for the contiguous data structures.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef SimdSearch_hpp
+#define SimdSearch_hpp
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Pick the widest vector instruction set the compiler targets. Define SIMDSEARCH_SCALAR to turn the kernels off.
+#if !defined(SIMDSEARCH_SCALAR)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define SIMDSEARCH_AVX2
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define SIMDSEARCH_SSE2
+    #elif defined(__aarch64__) && defined(__ARM_NEON)
+        #include <arm_neon.h>
+        #define SIMDSEARCH_NEON
+    #endif
+#endif
+
+#if defined(SIMDSEARCH_AVX2) || defined(SIMDSEARCH_SSE2) || defined(SIMDSEARCH_NEON)
+    #define SIMDSEARCH_VECTOR
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace DataStructures
+{
+
+/**
+ * @class   SimdSearch
+ * @brief   Vectorized find and compare kernels for arrays of elements.
+ * @details Arrays of integers (except bool), floats and doubles are handled with SSE2, AVX2 or
+ *          NEON, whichever the compiler targets, a whole vector of elements per comparison.
+ *          Every other data type, or a build without any of those instruction sets, falls back
+ *          to comparing one element at a time with operator== (or operator!= for the compare).
+ *
+ * @note    The vectorized comparisons give the exact same results as operator== does,
+ *          for floating point elements too (NaN is never equal, 0.0 equals -0.0).
+ */
+class SimdSearch
+{
+public:
+    // ----------- FUNCTIONS ------------
+    template <typename T>
+    static int find(const T* data, const int count, const T& value);
+    template <typename T>
+    static bool equal(const T* first, const T* second, const int count);
+    
+private:
+    // -------------- TYPES -------------
+    struct ScalarLane {};       /**< Elements that are compared with operator==. */
+    template <int Size>
+    struct IntegerLane {};      /**< Integer elements of the given size in bytes. */
+    struct FloatLane {};        /**< Single precision floating point elements. */
+    struct DoubleLane {};       /**< Double precision floating point elements. */
+    
+    /**
+     * @struct  LaneOf
+     * @brief   Selects how elements of type T are compared.
+     */
+    template <typename T>
+    struct LaneOf
+    {
+        typedef typename std::remove_cv<T>::type Type;
+        static const bool isInteger = std::is_integral<Type>::value && !std::is_same<Type, bool>::value
+                                      && (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8);
+#if defined(SIMDSEARCH_VECTOR)
+        typedef typename std::conditional<std::is_same<Type, float>::value, FloatLane,
+                typename std::conditional<std::is_same<Type, double>::value, DoubleLane,
+                typename std::conditional<isInteger, IntegerLane<sizeof(Type)>, ScalarLane>::type>::type>::type type;
+#else
+        typedef ScalarLane type;
+#endif
+    };
+
+#if defined(SIMDSEARCH_AVX2)
+    typedef __m256i Vector;     /**< One vector register. */
+    typedef std::uint32_t Mask; /**< One bit for every byte of a vector. */
+    static const int MASK_BITS_PER_BYTE = 1;
+#elif defined(SIMDSEARCH_SSE2)
+    typedef __m128i Vector;     /**< One vector register. */
+    typedef std::uint32_t Mask; /**< One bit for every byte of a vector. */
+    static const int MASK_BITS_PER_BYTE = 1;
+#elif defined(SIMDSEARCH_NEON)
+    typedef uint8x16_t Vector;  /**< One vector register. */
+    typedef std::uint64_t Mask; /**< Four bits for every byte of a vector. */
+    static const int MASK_BITS_PER_BYTE = 4;
+#endif
+
+    // ----------- FUNCTIONS ------------
+    template <typename T>
+    static int find(const T* data, const int count, const T& value, ScalarLane);
+    template <typename T>
+    static bool equal(const T* first, const T* second, const int count, ScalarLane);
+#if defined(SIMDSEARCH_VECTOR)
+    template <typename T, typename Lane>
+    static int find(const T* data, const int count, const T& value, Lane lane);
+    template <typename T, typename Lane>
+    static bool equal(const T* first, const T* second, const int count, Lane lane);
+    
+    static Vector load(const void* address);
+    static Mask mask(const Vector& compared);
+    static int firstSetBit(Mask mask);
+    template <typename T, int Size>
+    static Vector splat(const T& value, IntegerLane<Size>);
+    static Vector splat(const float& value, FloatLane);
+    static Vector splat(const double& value, DoubleLane);
+    static Vector compare(const Vector& first, const Vector& second, IntegerLane<1>);
+    static Vector compare(const Vector& first, const Vector& second, IntegerLane<2>);
+    static Vector compare(const Vector& first, const Vector& second, IntegerLane<4>);
+    static Vector compare(const Vector& first, const Vector& second, IntegerLane<8>);
+    static Vector compare(const Vector& first, const Vector& second, FloatLane);
+    static Vector compare(const Vector& first, const Vector& second, DoubleLane);
+#endif
+};
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Finds the first element of an array that is equal to a value.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The array to search.
+ * @param count The number of elements in the array.
+ * @param value The value being searched for.
+ * @return      The index of the first equal element, or -1 if no element is equal to the value.
+ */
+template <typename T>
+int SimdSearch::find(const T* data, const int count, const T& value)
+{
+    return find(data, count, value, typename LaneOf<T>::type());
+}
+
+/**
+ * @brief   Compares two arrays element by element.
+ *
+ * @tparam T        Any data type or class.
+ * @param first     The first array.
+ * @param second    The second array.
+ * @param count     The number of elements in each array.
+ * @return          True if every element of the first array is equal to the element at the same index of the second array.
+ */
+template <typename T>
+bool SimdSearch::equal(const T* first, const T* second, const int count)
+{
+    return equal(first, second, count, typename LaneOf<T>::type());
+}
+
+/**
+ * @brief   Finds the first element of an array that is equal to a value, one element at a time.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The array to search.
+ * @param count The number of elements in the array.
+ * @param value The value being searched for.
+ * @return      The index of the first equal element, or -1 if no element is equal to the value.
+ */
+template <typename T>
+int SimdSearch::find(const T* data, const int count, const T& value, ScalarLane)
+{
+    for(int index = 0; index < count; index++)
+        if(data[index] == value)
+            return index;
+    
+    return -1;
+}
+
+/**
+ * @brief   Compares two arrays one element at a time.
+ *
+ * @tparam T        Any data type or class.
+ * @param first     The first array.
+ * @param second    The second array.
+ * @param count     The number of elements in each array.
+ * @return          True if every element of the first array is equal to the element at the same index of the second array.
+ */
+template <typename T>
+bool SimdSearch::equal(const T* first, const T* second, const int count, ScalarLane)
+{
+    for(int index = 0; index < count; index++)
+        if(first[index] != second[index])
+            return false;
+    
+    return true;
+}
+
+#if defined(SIMDSEARCH_VECTOR)
+/**
+ * @brief   Finds the first element of an array that is equal to a value, one vector at a time.
+ *
+ * @tparam T    Any integer or floating point type.
+ * @tparam Lane How the elements are compared.
+ * @param data  The array to search.
+ * @param count The number of elements in the array.
+ * @param value The value being searched for.
+ * @param lane  Selects the comparison.
+ * @return      The index of the first equal element, or -1 if no element is equal to the value.
+ *
+ * @details The elements that do not fill a whole vector at the end of the array are compared one at a time.
+ */
+template <typename T, typename Lane>
+int SimdSearch::find(const T* data, const int count, const T& value, Lane lane)
+{
+    const int laneCount = (int)(sizeof(Vector) / sizeof(T));
+    const Vector needle = splat(value, lane);
+    
+    int index = 0;
+    for(; index + laneCount <= count; index += laneCount)
+    {
+        Mask matches = mask(compare(load(data + index), needle, lane));
+        if(matches != 0)
+            return index + firstSetBit(matches) / (MASK_BITS_PER_BYTE * (int)sizeof(T));
+    }
+    
+    for(; index < count; index++)
+        if(data[index] == value)
+            return index;
+    
+    return -1;
+}
+
+/**
+ * @brief   Compares two arrays one vector at a time.
+ *
+ * @tparam T        Any integer or floating point type.
+ * @tparam Lane     How the elements are compared.
+ * @param first     The first array.
+ * @param second    The second array.
+ * @param count     The number of elements in each array.
+ * @param lane      Selects the comparison.
+ * @return          True if every element of the first array is equal to the element at the same index of the second array.
+ */
+template <typename T, typename Lane>
+bool SimdSearch::equal(const T* first, const T* second, const int count, Lane lane)
+{
+    const int laneCount = (int)(sizeof(Vector) / sizeof(T));
+    const Mask allEqual = (Mask)~(Mask)0 >> (8 * sizeof(Mask) - MASK_BITS_PER_BYTE * sizeof(Vector));
+    
+    int index = 0;
+    for(; index + laneCount <= count; index += laneCount)
+        if(mask(compare(load(first + index), load(second + index), lane)) != allEqual)
+            return false;
+    
+    for(; index < count; index++)
+        if(first[index] != second[index])
+            return false;
+    
+    return true;
+}
+
+/**
+ * @brief   Returns the index of the lowest set bit of a mask.
+ *
+ * @param mask  The mask. Must not be 0.
+ * @return      The index of the lowest set bit.
+ */
+inline int SimdSearch::firstSetBit(Mask mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    #if defined(SIMDSEARCH_NEON)
+    _BitScanForward64(&index, mask);
+    #else
+    _BitScanForward(&index, mask);
+    #endif
+    return (int)index;
+#elif defined(SIMDSEARCH_NEON)
+    return __builtin_ctzll(mask);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * @brief   Copies the bytes of an integer value into every lane of a vector.
+ *
+ * @tparam T    Any integer type.
+ * @tparam Size The size of the integer type in bytes.
+ * @param value The value to copy.
+ * @return      The vector.
+ */
+template <typename T, int Size>
+SimdSearch::Vector SimdSearch::splat(const T& value, IntegerLane<Size>)
+{
+    typedef typename std::conditional<Size == 1, std::uint8_t,
+            typename std::conditional<Size == 2, std::uint16_t,
+            typename std::conditional<Size == 4, std::uint32_t, std::uint64_t>::type>::type>::type Bits;
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(Bits));
+
+#if defined(SIMDSEARCH_AVX2)
+    switch(Size)
+    {
+        case 1: return _mm256_set1_epi8((char)bits);
+        case 2: return _mm256_set1_epi16((short)bits);
+        case 4: return _mm256_set1_epi32((int)bits);
+        default: return _mm256_set1_epi64x((long long)bits);
+    }
+#elif defined(SIMDSEARCH_SSE2)
+    switch(Size)
+    {
+        case 1: return _mm_set1_epi8((char)bits);
+        case 2: return _mm_set1_epi16((short)bits);
+        case 4: return _mm_set1_epi32((int)bits);
+        default: return _mm_set1_epi64x((long long)bits);
+    }
+#else
+    switch(Size)
+    {
+        case 1: return vdupq_n_u8((std::uint8_t)bits);
+        case 2: return vreinterpretq_u8_u16(vdupq_n_u16((std::uint16_t)bits));
+        case 4: return vreinterpretq_u8_u32(vdupq_n_u32((std::uint32_t)bits));
+        default: return vreinterpretq_u8_u64(vdupq_n_u64((std::uint64_t)bits));
+    }
+#endif
+}
+
+#if defined(SIMDSEARCH_AVX2)
+/** Loads one unaligned vector. */
+inline SimdSearch::Vector SimdSearch::load(const void* address) { return _mm256_loadu_si256(static_cast<const __m256i*>(address)); }
+/** Returns one bit for every byte of a comparison result. */
+inline SimdSearch::Mask SimdSearch::mask(const Vector& compared) { return (Mask)_mm256_movemask_epi8(compared); }
+/** Copies a float into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const float& value, FloatLane) { return _mm256_castps_si256(_mm256_set1_ps(value)); }
+/** Copies a double into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const double& value, DoubleLane) { return _mm256_castpd_si256(_mm256_set1_pd(value)); }
+/** Compares the 1 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<1>) { return _mm256_cmpeq_epi8(first, second); }
+/** Compares the 2 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<2>) { return _mm256_cmpeq_epi16(first, second); }
+/** Compares the 4 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<4>) { return _mm256_cmpeq_epi32(first, second); }
+/** Compares the 8 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<8>) { return _mm256_cmpeq_epi64(first, second); }
+/** Compares the float lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, FloatLane)
+{
+    return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(first), _mm256_castsi256_ps(second), _CMP_EQ_OQ));
+}
+/** Compares the double lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, DoubleLane)
+{
+    return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(first), _mm256_castsi256_pd(second), _CMP_EQ_OQ));
+}
+#elif defined(SIMDSEARCH_SSE2)
+/** Loads one unaligned vector. */
+inline SimdSearch::Vector SimdSearch::load(const void* address) { return _mm_loadu_si128(static_cast<const __m128i*>(address)); }
+/** Returns one bit for every byte of a comparison result. */
+inline SimdSearch::Mask SimdSearch::mask(const Vector& compared) { return (Mask)_mm_movemask_epi8(compared); }
+/** Copies a float into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const float& value, FloatLane) { return _mm_castps_si128(_mm_set1_ps(value)); }
+/** Copies a double into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const double& value, DoubleLane) { return _mm_castpd_si128(_mm_set1_pd(value)); }
+/** Compares the 1 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<1>) { return _mm_cmpeq_epi8(first, second); }
+/** Compares the 2 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<2>) { return _mm_cmpeq_epi16(first, second); }
+/** Compares the 4 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<4>) { return _mm_cmpeq_epi32(first, second); }
+/** Compares the 8 byte lanes of two vectors. SSE2 has no 64 bit comparison, so both 32 bit halves have to match. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<8>)
+{
+    __m128i halves = _mm_cmpeq_epi32(first, second);
+    return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+/** Compares the float lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, FloatLane)
+{
+    return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(first), _mm_castsi128_ps(second)));
+}
+/** Compares the double lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, DoubleLane)
+{
+    return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(first), _mm_castsi128_pd(second)));
+}
+#elif defined(SIMDSEARCH_NEON)
+/** Loads one unaligned vector. */
+inline SimdSearch::Vector SimdSearch::load(const void* address) { return vld1q_u8(static_cast<const std::uint8_t*>(address)); }
+/** Returns four bits for every byte of a comparison result, by narrowing every 16 bit lane to 8 bits. */
+inline SimdSearch::Mask SimdSearch::mask(const Vector& compared)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(compared), 4)), 0);
+}
+/** Copies a float into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const float& value, FloatLane) { return vreinterpretq_u8_f32(vdupq_n_f32(value)); }
+/** Copies a double into every lane of a vector. */
+inline SimdSearch::Vector SimdSearch::splat(const double& value, DoubleLane) { return vreinterpretq_u8_f64(vdupq_n_f64(value)); }
+/** Compares the 1 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<1>) { return vceqq_u8(first, second); }
+/** Compares the 2 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<2>)
+{
+    return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(first), vreinterpretq_u16_u8(second)));
+}
+/** Compares the 4 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<4>)
+{
+    return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(first), vreinterpretq_u32_u8(second)));
+}
+/** Compares the 8 byte lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, IntegerLane<8>)
+{
+    return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(first), vreinterpretq_u64_u8(second)));
+}
+/** Compares the float lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, FloatLane)
+{
+    return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(first), vreinterpretq_f32_u8(second)));
+}
+/** Compares the double lanes of two vectors. */
+inline SimdSearch::Vector SimdSearch::compare(const Vector& first, const Vector& second, DoubleLane)
+{
+    return vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(first), vreinterpretq_f64_u8(second)));
+}
+#endif
+#endif
+
+} // namespace DataStructures
+
+#endif /* SimdSearch_hpp */
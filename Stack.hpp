@@ -14,41 +14,105 @@
 #ifndef Stack_hpp
 #define Stack_hpp
 
+#include <memory>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include "NodeStorage.hpp"
+#include "Serialization.hpp"
+#include "BufferedWriter.hpp"
+
+namespace DataStructures
+{
+
+template <typename T>
+struct StackNode;
+
+/**
+ * @brief   Visits the data of a chain of stack nodes from the bottom to the top, without changing the links.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Function A callable that takes a constant reference to the data.
+ * @param top       The top node of the chain, or nullptr for an empty chain.
+ * @param visit     The function every element is passed to.
+ *
+ * @details The nodes only link downwards, so the chain is walked once from the top to remember every
+ *          √n-th node, and then every segment between two remembered nodes is gathered into a small
+ *          buffer and visited backwards, from the bottom segment up. That takes O(n) time and O(√n) memory,
+ *          and the nodes are only read, so several threads can visit the same chain at once.
+ */
+template <typename T, typename Function>
+void forEachFromBottom(const StackNode<T>* top, Function visit)
+{
+    if(top == nullptr)
+        return;
+    
+    long long count = 0;
+    for(const StackNode<T>* node = top; node != nullptr; node = node->previous)
+        count++;
+    
+    int segmentSize = 1;
+    while((long long)segmentSize * segmentSize < count)
+        segmentSize++;
+    
+    std::vector<const StackNode<T>*> checkpoints;   // The top node of every segment.
+    checkpoints.reserve((std::size_t)(count / segmentSize + 1));
+    long long position = 0;
+    for(const StackNode<T>* node = top; node != nullptr; node = node->previous, position++)
+    {
+        if(position % segmentSize == 0)
+            checkpoints.push_back(node);
+    }
+    
+    std::vector<const StackNode<T>*> segment(segmentSize);
+    for(int i = (int)checkpoints.size() - 1; i >= 0; i--)
+    {
+        int length = 0;
+        for(const StackNode<T>* node = checkpoints[i]; node != nullptr && length < segmentSize; node = node->previous)
+            segment[length++] = node;
+        for(int j = length - 1; j >= 0; j--)
+            visit(segment[j]->data);
+    }
+}
 
 /**
- * @struct  Node
- * @brief   The Node struct is meant to hold the data and pointer to the previous stack element.
+ * @struct  StackNode
+ * @brief   The StackNode struct is meant to hold the data and pointer to the previous stack element.
  *
  * @tparam T    Any data type or class.
  */
 template <typename T>
-struct Node
+struct StackNode
 {
     // ------------- FIELDS -------------
-    T data;             /**< The data. */
-    Node<T>* previous;  /**< Pointer to the previous node in the stack. */
+    T data;                  /**< The data. */
+    StackNode<T>* previous;  /**< Pointer to the previous node in the stack. */
     
     // ---------- CONSTRUCTORS ----------
     /** Copy Constructor. */
-    Node(const T& data) : data(data), previous(nullptr) {}
+    StackNode(const T& data) : data(data), previous(nullptr) {}
     /** Move Constructor. */
-    Node(T&& data) : data(std::forward<T>(data)), previous(nullptr) {}
-    /** Struct Destructor. */
-    ~Node()
-    {
-        delete previous;
-        previous = nullptr;
-    }
+    StackNode(T&& data) : data(std::forward<T>(data)), previous(nullptr) {}
+    /** Emplace Constructor. */
+    template <typename... Args>
+    StackNode(EmplaceTag, Args&&... args) : data(std::forward<Args>(args)...), previous(nullptr) {}
     
     // ----- NON-MEMEBER OPERATORS ------
-    friend std::ostream& operator<<(std::ostream& output, const Node<T>& node)
+    friend std::ostream& operator<<(std::ostream& output, const StackNode<T>& node)
     {
-        if(node.previous)
-            return output << *node.previous << ", " << node.data;
-        else
-            return output << node.data;
+        bool first = true;
+        forEachFromBottom(&node, [&output, &first](const T& data)
+        {
+            if(!first)
+                output << ", ";
+            output << data;
+            first = false;
+        });
+        
+        return output;
     }
 };
 
@@ -64,21 +128,42 @@ class Stack
 public:
     // ---------- CONSTRUCTORS ----------
     Stack();
+    explicit Stack(const std::shared_ptr<NodePool<StackNode<T>>>& sharedPool);
+    template <typename InputIterator>
+    Stack(InputIterator first, InputIterator last);
+    Stack(std::initializer_list<T> elements);
     Stack(const Stack<T>& copyStack);
-    Stack(Stack<T>&& moveStack);
+    Stack(Stack<T>&& moveStack) noexcept;
     ~Stack();
     
     // ----------- FUNCTIONS ------------
-    void push(const T data);
+    void push(const T& data);
+    void push(T&& data);
+    template <typename... Args>
+    void emplace(Args&&... args);
     T pop();
-    T peek();
-    int size();
-    bool empty();
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    int size() const;
+    bool empty() const;
     void clear();
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last);
+    std::shared_ptr<NodePool<StackNode<T>>> getPool();
+#if defined(DATASTRUCTURES_STATS)
+    const ContainerStats& stats();
+#endif
+    void serialize(std::ostream& output) const;
+    void deserialize(std::istream& input);
+    void serializeFlat(std::ostream& output) const;
+    void deserializeFlat(const void* data, const std::size_t bytes);
+    template <typename Sink>
+    void writeTo(Sink& sink, const char* separator = ", ") const;
     
     // ----------- OPERATORS ------------
     Stack<T>& operator=(const Stack& copyStack);
-    Stack<T>& operator=(Stack&& moveStack);
+    Stack<T>& operator=(Stack&& moveStack) noexcept;
     
     // ----- NON-MEMEBER OPERATORS ------
     template <typename Type>
@@ -86,14 +171,15 @@ public:
     
 private:
     // ------------- FIELDS -------------
-    Node<T>* top;   /**< The top of the stack. */
-    int stackSize;  /**< The size of the stack. */
+    StackNode<T>* top;                /**< The top of the stack. */
+    int stackSize;                    /**< The size of the stack. */
+    NodeStorage<StackNode<T>> nodes;  /**< Allocates every node of the stack from a shared node pool. */
     
     // ----------- FUNCTIONS ------------
+    void copyFrom(const Stack<T>& copyStack);
     void swap(Stack<T>& other);
 };
 
-#endif /* Stack_hpp */
 
 // **************************************************************************
 // **************************************************************************
@@ -114,23 +200,61 @@ private:
 template <typename T>
 Stack<T>::Stack() : top(nullptr), stackSize(0) {}
 
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T            Any data type or class.
+ * @param sharedPool    The node pool this stack object will allocate its nodes from.
+ *
+ * @details Initializes an empty stack object that shares its node pool with every other
+ *          stack constructed from the same pool.
+ */
+template <typename T>
+Stack<T>::Stack(const std::shared_ptr<NodePool<StackNode<T>>>& sharedPool) : top(nullptr), stackSize(0), nodes(sharedPool) {}
+
+/**
+ * @brief   Range Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Initializes this stack object with the elements of the range. See assign().
+ */
+template <typename T>
+template <typename InputIterator>
+Stack<T>::Stack(InputIterator first, InputIterator last) : Stack()
+{
+    assign(first, last);
+}
+
+/**
+ * @brief   Initializer List Constructor.
+ *
+ * @tparam T        Any data type or class.
+ * @param elements  The elements this stack object will hold.
+ *
+ * @details Initializes this stack object with the elements of the list. See assign().
+ */
+template <typename T>
+Stack<T>::Stack(std::initializer_list<T> elements) : Stack()
+{
+    assign(elements.begin(), elements.end());
+}
+
 /**
  * @brief   Copy Constructor.
  *
  * @tparam T        Any data type or class.
  * @param copyStack The stack whose elements will be copied into this stack object.
+ *
+ * @details Every node is reserved from the node pool with a single allocation.
  */
 template <typename T>
 Stack<T>::Stack(const Stack<T>& copyStack) : top(nullptr), stackSize(0)
 {
-    Node<T>** currentNode = &top;
-    for(Node<T>* copyNode = copyStack.top; copyNode; copyNode = copyNode->previous)
-    {
-        (*currentNode) = new Node<T>(copyNode->data);
-        
-        currentNode = &(*currentNode)->previous;
-        stackSize++;
-    }
+    copyFrom(copyStack);
 }
 
 /**
@@ -139,20 +263,15 @@ Stack<T>::Stack(const Stack<T>& copyStack) : top(nullptr), stackSize(0)
  * @tparam T        Any data type or class.
  * @param moveStack The stack whose elements will be moved into this stack object.
  *
+ * @details Takes over the nodes of the provided stack in constant time,
+ *          without allocating. The provided stack object is empty afterwards.
+ *
  * @note std::move() needs to be used to call this constructor.
  */
 template <typename T>
-Stack<T>::Stack(Stack<T>&& moveStack) : top(nullptr), stackSize(0)
+Stack<T>::Stack(Stack<T>&& moveStack) noexcept : top(nullptr), stackSize(0)
 {
-    Node<T>** currentNode = &top;
-    for(Node<T>* moveNode = moveStack.top; moveNode; moveNode = moveNode->previous)
-    {
-        (*currentNode) = new Node<T>(std::move(moveNode->data));
-        
-        currentNode = &(*currentNode)->previous;
-        stackSize++;
-    }
-    moveStack.clear();
+    moveStack.swap(*this);
 }
 
 /**
@@ -160,7 +279,7 @@ Stack<T>::Stack(Stack<T>&& moveStack) : top(nullptr), stackSize(0)
  *
  * @tparam T    Any data type or class.
  *
- * @details Recursively clears the stack using clear() function.
+ * @details Clears the stack using clear() function.
  */
 template <typename T>
 Stack<T>::~Stack()
@@ -178,9 +297,38 @@ Stack<T>::~Stack()
  * @param data  The element you want to add to the stack.
  */
 template <typename T>
-void Stack<T>::push(const T data)
+void Stack<T>::push(const T& data)
+{
+    emplace(data);
+}
+
+/**
+ * @brief   Moves element to the top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @param data  The element you want to move into the stack.
+ */
+template <typename T>
+void Stack<T>::push(T&& data)
 {
-    Node<T>* node_newTop = new Node<T>(data);
+    emplace(std::move(data));
+}
+
+/**
+ * @brief   Constructs element in place at the top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @tparam Args The types of the constructor arguments.
+ * @param args  The arguments forwarded to the constructor of the element.
+ */
+template <typename T>
+template <typename... Args>
+void Stack<T>::emplace(Args&&... args)
+{
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::PUSH);
+#endif
+    StackNode<T>* node_newTop = nodes.create(EmplaceTag(), std::forward<Args>(args)...);
     node_newTop->previous = top;
     top = node_newTop;
     stackSize++;
@@ -192,6 +340,8 @@ void Stack<T>::push(const T data)
  * @tparam T    Any data type or class.
  * @return      The removed element.
  *
+ * @details The element is moved out of the removed node, not copied.
+ *
  * @throw   std::underflow_error
  * @warning Throws an Underflow Error exception if the stack is empty when function is called.
  */
@@ -200,29 +350,74 @@ T Stack<T>::pop()
 {
     if(top == nullptr)
         throw std::underflow_error("Stack is Empty");
-    
-    Node<T>* deleteTop = top;
-    T popped_data = top->data;
+#if defined(DATASTRUCTURES_STATS)
+    ContainerStats::Timer timer(nodes.getStats(), ContainerStats::POP);
+#endif
+
+    StackNode<T>* deleteTop = top;
+    T popped_data = std::move(top->data);
     top = top->previous;
     
-    deleteTop->previous = nullptr;
-    delete deleteTop;
+    nodes.destroy(deleteTop);
     stackSize--;
     
     return popped_data;
 }
 
+/**
+ * @brief   Removes the top of the stack and moves it into the provided variable.
+ *
+ * @tparam T    Any data type or class.
+ * @param out   The variable that receives the removed element.
+ * @return      True if an element was removed, false if the stack is empty.
+ *
+ * @details Works like pop() but reports an empty stack through the return value instead of throwing.
+ */
+template <typename T>
+bool Stack<T>::tryPop(T& out)
+{
+    if(top == nullptr)
+        return false;
+    
+    StackNode<T>* deleteTop = top;
+    out = std::move(top->data);
+    top = top->previous;
+    
+    nodes.destroy(deleteTop);
+    stackSize--;
+    
+    return true;
+}
+
 /**
  * @brief   Returns, but does not remove, the top of the stack.
  *
  * @tparam T    Any data type or class.
- * @return      The element located at the top of the stack.
+ * @return      A reference to the element located at the top of the stack.
  *
  * @throw   std::underflow_error
  * @warning Throws an Underflow Error exception if the stack is empty when function is called.
  */
 template <typename T>
-T Stack<T>::peek()
+T& Stack<T>::peek()
+{
+    if(top == nullptr)
+        throw std::underflow_error("Stack is Empty");
+    
+    return top->data;
+}
+
+/**
+ * @brief   Returns, but does not remove, the top of the stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      A constant reference to the element located at the top of the stack.
+ *
+ * @throw   std::underflow_error
+ * @warning Throws an Underflow Error exception if the stack is empty when function is called.
+ */
+template <typename T>
+const T& Stack<T>::peek() const
 {
     if(top == nullptr)
         throw std::underflow_error("Stack is Empty");
@@ -237,7 +432,7 @@ T Stack<T>::peek()
  * @return      The size of the stack.
  */
 template <typename T>
-int Stack<T>::size()
+int Stack<T>::size() const
 {
     return stackSize;
 }
@@ -249,24 +444,255 @@ int Stack<T>::size()
  * @return      A boolean flag.
  */
 template <typename T>
-bool Stack<T>::empty()
+bool Stack<T>::empty() const
 {
     return stackSize == 0;
 }
 
 /**
- * @brief   Clears the entire stack recursively and resets all field elements to default.
+ * @brief   Clears the entire stack and resets all field elements to default.
  *
  * @tparam T    Any data type or class.
+ *
+ * @details Walks the stack iteratively, so it never needs more than constant stack space.
+ *          If this stack is the only user of its node pool, the whole pool is released at once,
+ *          and the walk is skipped entirely when the elements are trivially destructible.
+ *          Otherwise every node is given back to the shared pool for reuse.
  */
 template <typename T>
 void Stack<T>::clear()
 {
-    delete top;
+    nodes.destroyChain(top, &StackNode<T>::previous);
+    
     top = nullptr;
     stackSize = 0;
 }
 
+/**
+ * @brief   Replaces the contents of the stack with the elements of a range.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam InputIterator    An input iterator over elements of type T.
+ * @param first             The first element of the range.
+ * @param last              One past the last element of the range.
+ *
+ * @details Builds the stack in one pass over the range. The elements are pushed in range order,
+ *          so the last element of the range ends up on top. When the size of the range
+ *          can be counted up front, every node is reserved from the node pool with a single allocation.
+ *
+ * @warning The range must not point into this stack.
+ */
+template <typename T>
+template <typename InputIterator>
+void Stack<T>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    
+    int count = rangeSize(first, last);
+    nodes.reserve(count);
+    
+    for(; first != last; ++first)
+        emplace(*first);
+}
+
+/**
+ * @brief   Returns the node pool used by this stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The shared node pool.
+ *
+ * @details The returned pool can be passed to the Shared Pool Constructor of another stack
+ *          so both stacks allocate from, and recycle into, the same pool.
+ */
+template <typename T>
+std::shared_ptr<NodePool<StackNode<T>>> Stack<T>::getPool()
+{
+    return nodes.getPool();
+}
+
+#if defined(DATASTRUCTURES_STATS)
+/**
+ * @brief   Returns the statistics of this stack.
+ *
+ * @tparam T    Any data type or class.
+ * @return      The statistics, with the bytes held brought up to date.
+ *
+ * @details Counts the nodes allocated and freed and the bytes held by the nodes. For push() and
+ *          pop() it also counts the calls and the latencies, they never traverse any node.
+ *
+ * @note    Only available when DATASTRUCTURES_STATS is defined.
+ */
+template <typename T>
+const ContainerStats& Stack<T>::stats()
+{
+    ContainerStats& stackStats = nodes.getStats();
+    stackStats.recordBytesHeld((long long)stackSize * sizeof(StackNode<T>));
+    return stackStats;
+}
+#endif
+
+/**
+ * @brief   Writes the stack to a stream in the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then every element from top to bottom with ElementCodec<T>,
+ *          iteratively, so a stack of any height can be written. Read it back with deserialize().
+ */
+template <typename T>
+void Stack<T>::serialize(std::ostream& output) const
+{
+    writeSerialHeader(output, SERIAL_MAGIC, SERIAL_STACK, 0, ElementCodec<T>::SIZE, (std::uint64_t)stackSize);
+    for(const StackNode<T>* node = top; node != nullptr; node = node->previous)
+        ElementCodec<T>::write(output, node->data);
+}
+
+/**
+ * @brief   Replaces the contents of the stack with a stack read from the compact binary format.
+ *
+ * @tparam T        Any data type or class with an ElementCodec.
+ * @param input     The input stream, opened in binary mode, at data written by serialize().
+ *
+ * @details The elements are read from top to bottom, and every one is linked in below the one before
+ *          it, in a new stack that allocates from the node pool of this stack and then takes the place
+ *          of this stack. If anything goes wrong, this stack is unchanged.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serialize() of a Stack
+ *          with the same element type, or if the input ends early.
+ */
+template <typename T>
+void Stack<T>::deserialize(std::istream& input)
+{
+    SerialHeader header = readSerialHeader(input, SERIAL_STACK, ElementCodec<T>::SIZE);
+    Stack<T> temp(nodes.getPool());
+    StackNode<T>** bottom = &temp.top;
+    for(std::uint64_t i = 0; i < header.count; i++)
+    {
+        *bottom = temp.nodes.create(ElementCodec<T>::read(input));
+        bottom = &(*bottom)->previous;
+        temp.stackSize++;
+    }
+    
+    swap(temp);
+}
+
+/**
+ * @brief   Writes the stack to a stream in the flat binary format.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param output    The output stream, opened in binary mode.
+ *
+ * @details Writes a SerialHeader and then the raw elements from top to bottom, aligned for T, so the
+ *          written file can be memory mapped and used in place through a FlatView, or loaded again
+ *          with deserializeFlat().
+ */
+template <typename T>
+void Stack<T>::serializeFlat(std::ostream& output) const
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The flat format needs a trivially copyable element type");
+    
+    writeSerialHeader(output, FLAT_MAGIC, SERIAL_STACK, 0, sizeof(T), (std::uint64_t)stackSize, alignof(T));
+    for(const StackNode<T>* node = top; node != nullptr; node = node->previous)
+        output.write(reinterpret_cast<const char*>(&node->data), sizeof(T));
+}
+
+/**
+ * @brief   Replaces the contents of the stack with the elements of data in the flat binary format.
+ *
+ * @tparam T        A trivially copyable type.
+ * @param data      The start of data written by serializeFlat(), for example a memory mapped file.
+ * @param bytes     The size of the data.
+ *
+ * @details Nothing is parsed, the elements are copied straight out of the data with assign(), from the
+ *          bottom up, which reserves every node with a single allocation.
+ *
+ * @throw   std::runtime_error
+ * @warning Throws a Runtime Error exception if the data was not written by serializeFlat() of a Stack
+ *          with the same element type, or if it is truncated or misaligned. This stack is unchanged then.
+ */
+template <typename T>
+void Stack<T>::deserializeFlat(const void* data, const std::size_t bytes)
+{
+    FlatView<T> view(data, bytes, SERIAL_STACK);
+    assign(std::reverse_iterator<const T*>(view.end()), std::reverse_iterator<const T*>(view.begin()));
+}
+
+/**
+ * @brief   Writes every element of the stack to a sink, from the bottom to the top.
+ *
+ * @tparam T        Any data type or class.
+ * @tparam Sink     Any type with a write(const char* data, std::size_t size) function, like std::ostream,
+ *                  StringSink, BufferSink or FileDescriptorSink.
+ * @param sink      The sink the elements are written to.
+ * @param separator The text written between two elements.
+ *
+ * @details The nodes only link downwards, so the stack is walked from the bottom up with forEachFromBottom(),
+ *          which only reads the nodes and keeps O(√n) of them in a buffer. The elements are written with
+ *          constant stack space through a BufferedWriter. When the sink is a stream, the elements are
+ *          formatted with the formatting of the stream.
+ */
+template <typename T>
+template <typename Sink>
+void Stack<T>::writeTo(Sink& sink, const char* separator) const
+{
+    BufferedWriter<Sink> writer(sink, formatOf(sink));
+    bool first = true;
+    forEachFromBottom(top, [&writer, &first, separator](const T& data)
+    {
+        if(!first)
+            writer.write(separator);
+        writer.writeElement(data);
+        first = false;
+    });
+    
+    writer.flush();
+}
+
+/**
+ * @brief   Copies the elements of another stack into this stack.
+ *
+ * @tparam T            Any data type or class.
+ * @param copyStack     The stack whose elements will be copied into this stack object.
+ *
+ * @details The nodes this stack already has are reused in place, from the top down. Extra nodes
+ *          are destroyed, and the missing nodes are reserved from the node pool with a single allocation.
+ */
+template <typename T>
+void Stack<T>::copyFrom(const Stack<T>& copyStack)
+{
+    StackNode<T>** currentNode = &top;
+    const StackNode<T>* copyNode = copyStack.top;
+    int copied = 0;
+    for(; *currentNode != nullptr && copyNode != nullptr; copyNode = copyNode->previous)
+    {
+        (*currentNode)->data = copyNode->data;
+        currentNode = &(*currentNode)->previous;
+        copied++;
+    }
+    
+    // This stack was taller, destroy the nodes below the copied ones.
+    StackNode<T>* extraNode = *currentNode;
+    *currentNode = nullptr;
+    while(extraNode != nullptr)
+    {
+        StackNode<T>* previousNode = extraNode->previous;
+        nodes.destroy(extraNode);
+        extraNode = previousNode;
+    }
+    stackSize = copied;
+    
+    // This stack was shorter, add the rest at the bottom.
+    nodes.reserve(copyStack.stackSize - copied);
+    for(; copyNode != nullptr; copyNode = copyNode->previous)
+    {
+        (*currentNode) = nodes.create(copyNode->data);
+        currentNode = &(*currentNode)->previous;
+        stackSize++;
+    }
+}
+
 /**
  * @brief   Swaps Stacks.
  *
@@ -276,13 +702,15 @@ void Stack<T>::clear()
 template <typename T>
 void Stack<T>::swap(Stack<T>& other)
 {
-    Node<T>* tempTop = top;
+    StackNode<T>* tempTop = top;
     top = other.top;
     other.top = tempTop;
     
     int tempSize = stackSize;
     stackSize = other.stackSize;
     other.stackSize = tempSize;
+    
+    nodes.swap(other.nodes);
 }
 
 // ------------------------------------------------------
@@ -295,13 +723,16 @@ void Stack<T>::swap(Stack<T>& other)
  * @param copyStack The stack object from which to copy elements.
  * @return          A reference to a copied stack object.
  *
- * @details Copies a stack with the help of the copy constructor and a custom swap function.
+ * @details Overwrites the elements of the nodes this stack already has and only creates,
+ *          or destroys, the nodes that make up the difference in size. If copying an element throws,
+ *          this stack is left valid but only partly copied.
  */
 template <typename T>
 Stack<T>& Stack<T>::operator=(const Stack& copyStack)
 {
-    Stack<T> tempStack(copyStack);
-    tempStack.swap(*this);
+    if(this != &copyStack)
+        copyFrom(copyStack);
+    
     return *this;
 }
 
@@ -318,7 +749,7 @@ Stack<T>& Stack<T>::operator=(const Stack& copyStack)
  * @note    std::move() needs to be used to call this operator.
  */
 template <typename T>
-Stack<T>& Stack<T>::operator=(Stack&& moveStack)
+Stack<T>& Stack<T>::operator=(Stack&& moveStack) noexcept
 {
     if(this == &moveStack)  // Make sure this and moveStack are not the same object.
         return *this;
@@ -340,6 +771,7 @@ Stack<T>& Stack<T>::operator=(Stack&& moveStack)
  *
  * @details Prints the stack elements to the specified output stream. Prints starting from the
  *          bottom of the stack and finishes printing at the top of the stack (BOTTOM, ... , TOP).
+ *          See writeTo(), which prints without recursion.
  *
  * @note    Any class or data type used with this stack class MUST implement its
  *          own operator<< in order for this operator<< to work correctly. All primitive
@@ -350,8 +782,11 @@ Stack<T>& Stack<T>::operator=(Stack&& moveStack)
 template <typename T>
 std::ostream& operator<<(std::ostream& output, const Stack<T>& stack)
 {
-    if (stack.top)
-        return output << "(" << *stack.top << ")";
-    else
-        return output << "()";
+    output << "(";
+    stack.writeTo(output);
+    return output << ")";
 }
+
+} // namespace DataStructures
+
+#endif /* Stack_hpp */
@@ -0,0 +1,1045 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    UnrolledList.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic Unrolled Doubly Linked List data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef UnrolledList_hpp
+#define UnrolledList_hpp
+
+#include <new>
+#include <memory>
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include "NodeStorage.hpp"
+#include "SimdSearch.hpp"
+
+namespace DataStructures
+{
+
+/**
+ * @struct  UnrolledBlock
+ * @brief   The UnrolledBlock struct holds several list elements next to each other and pointers to the previous and next block.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ */
+template <typename T, int BlockCapacity>
+struct UnrolledBlock
+{
+    // ------------- FIELDS -------------
+    alignas(T) unsigned char storage[BlockCapacity * sizeof(T)];    /**< The elements of the block. */
+    int count;                                                      /**< Number of elements in the block. */
+    UnrolledBlock<T, BlockCapacity>* next;                          /**< Pointer to the next block in the list. */
+    UnrolledBlock<T, BlockCapacity>* previous;                      /**< Pointer to the previous block in the list. */
+    
+    // ---------- CONSTRUCTORS ----------
+    /** Default Constructor. */
+    UnrolledBlock() : count(0), next(nullptr), previous(nullptr) {}
+    /** Struct Destructor. */
+    ~UnrolledBlock()
+    {
+        for(int i = count-1; i >= 0; i--)
+            data()[i].~T();
+    }
+    
+    // ----------- FUNCTIONS ------------
+    /** Returns the elements of the block as an array. */
+    T* data() { return reinterpret_cast<T*>(storage); }
+    /** Returns the elements of the block as a constant array. */
+    const T* data() const { return reinterpret_cast<const T*>(storage); }
+    
+    /** Constructs an element in place at the specified offset, shifting the following elements back by one. */
+    template <typename... Args>
+    void insertAt(const int offset, Args&&... args)
+    {
+        if(offset == count)
+        {
+            new (data() + count) T(std::forward<Args>(args)...);
+            count++;
+            return;
+        }
+        
+        T element(std::forward<Args>(args)...);   // The arguments might refer to an element of this block.
+        new (data() + count) T(std::move(data()[count-1]));
+        count++;    // Counted before the shift, so the new slot is destroyed with the block if an assignment throws.
+        for(int i = count-2; i > offset; i--)
+            data()[i] = std::move(data()[i-1]);
+        data()[offset] = std::move(element);
+    }
+    
+    /** Removes the element at the specified offset, shifting the following elements forward by one. */
+    void eraseAt(const int offset)
+    {
+        for(int i = offset; i < count-1; i++)
+            data()[i] = std::move(data()[i+1]);
+        data()[count-1].~T();
+        count--;
+    }
+    
+    /** Moves the elements from the specified offset onward to the end of another block. */
+    void moveTail(const int offset, UnrolledBlock<T, BlockCapacity>* other)
+    {
+        for(int i = offset; i < count; i++)
+        {
+            new (other->data() + other->count) T(std::move(data()[i]));
+            other->count++;
+        }
+        for(int i = count-1; i >= offset; i--)     // Only once every element was moved, so a throwing move destroys nothing twice.
+            data()[i].~T();
+        count = offset;
+    }
+};
+
+/**
+ * @class   UnrolledList
+ * @brief   A generic Unrolled Doubly Linked List class.
+ * @details This Unrolled Doubly Linked List is templated to use any data type or class. Every block
+ *          of the list stores up to BlockCapacity elements next to each other, so a scan over the
+ *          list touches a fraction of the cache lines a DLinkedList does, while inserting into
+ *          the middle of the list still only shifts the elements of a single block.
+ *          It has the same interface as DLinkedList.
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block. 16 by default.
+ */
+template <typename T, int BlockCapacity = 16>
+class UnrolledList
+{
+    static_assert(BlockCapacity > 0, "BlockCapacity must be positive");
+    
+public:
+    // ---------- CONSTRUCTORS ----------
+    UnrolledList();
+    explicit UnrolledList(const std::shared_ptr<NodePool<UnrolledBlock<T, BlockCapacity>>>& sharedPool);
+    UnrolledList(const UnrolledList<T, BlockCapacity>& copyList);
+    UnrolledList(UnrolledList<T, BlockCapacity>&& moveList) noexcept;
+    ~UnrolledList();
+    
+    // ----------- FUNCTIONS ------------
+    void addFirst(const T& data);
+    void addFirst(T&& data);
+    void addLast(const T& data);
+    void addLast(T&& data);
+    void insert(const T& data, const int index);
+    void insert(T&& data, const int index);
+    template <typename... Args>
+    void emplaceFirst(Args&&... args);
+    template <typename... Args>
+    void emplaceLast(Args&&... args);
+    template <typename... Args>
+    void emplace(const int index, Args&&... args);
+    void remove(const int index);
+    void clear();
+    T pop();
+    T pop(const int index);
+    bool tryPop(T& out);
+    T& peek();
+    const T& peek() const;
+    T& peek(const int index);
+    const T& peek(const int index) const;
+    int indexOf(const T& element) const;
+    int size() const;
+    bool empty() const;
+    int blocks();
+    std::shared_ptr<NodePool<UnrolledBlock<T, BlockCapacity>>> getPool();
+    
+    // ----------- OPERATORS ------------
+    T& operator[](const int index);
+    bool operator==(const UnrolledList& compareList);
+    UnrolledList<T, BlockCapacity>& operator=(const UnrolledList& copyList);
+    UnrolledList<T, BlockCapacity>& operator=(UnrolledList&& moveList) noexcept;
+    
+    // ----- NON-MEMEBER OPERATORS ------
+    template <typename Type, int Capacity>
+    friend std::ostream& operator<<(std::ostream& output, const UnrolledList<Type, Capacity>& list);
+    
+private:
+    // ------------- FIELDS -------------
+    UnrolledBlock<T, BlockCapacity>* head;  /**< The first block of the list. */
+    UnrolledBlock<T, BlockCapacity>* tail;  /**< The last block of the list. */
+    int listSize;                           /**< The size of the list. */
+    int blockCount;                         /**< The number of blocks in the list. */
+    NodeStorage<UnrolledBlock<T, BlockCapacity>> nodes;  /**< Allocates every block of the list from a shared block pool. */
+    
+    // ----------- FUNCTIONS ------------
+    UnrolledBlock<T, BlockCapacity>* createBlock(UnrolledBlock<T, BlockCapacity>* after);
+    void destroyBlock(UnrolledBlock<T, BlockCapacity>* block);
+    UnrolledBlock<T, BlockCapacity>* locate(const int index, int& offset) const;
+    template <typename... Args>
+    void insertInto(UnrolledBlock<T, BlockCapacity>* block, int offset, Args&&... args);
+    void removeFrom(UnrolledBlock<T, BlockCapacity>* block, const int offset);
+    void swap(UnrolledList<T, BlockCapacity>& other);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ *
+ * @details Initializes this linked list object with a nullptr head and tail and size of 0;
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>::UnrolledList() : head(nullptr), tail(nullptr), listSize(0), blockCount(0) {}
+
+/**
+ * @brief   Shared Pool Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param sharedPool        The block pool this linked list object will allocate its blocks from.
+ *
+ * @details Initializes an empty linked list object that shares its block pool with every other
+ *          list constructed from the same pool.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>::UnrolledList(const std::shared_ptr<NodePool<UnrolledBlock<T, BlockCapacity>>>& sharedPool) : head(nullptr), tail(nullptr), listSize(0), blockCount(0), nodes(sharedPool) {}
+
+/**
+ * @brief   Copy Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param copyList          The list whose contents will be copied into this linked list object.
+ *
+ * @details The copied elements are packed into full blocks.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>::UnrolledList(const UnrolledList<T, BlockCapacity>& copyList) : UnrolledList()
+{
+    for(const UnrolledBlock<T, BlockCapacity>* copyBlock = copyList.head; copyBlock; copyBlock = copyBlock->next)
+        for(int i = 0; i < copyBlock->count; i++)
+            emplaceLast(copyBlock->data()[i]);
+}
+
+/**
+ * @brief   Move Constructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param moveList          The list whose contents will be moved into this linked list object.
+ *
+ * @details Takes over the blocks of the provided linked list in constant time,
+ *          without allocating. The provided linked list object is empty afterwards.
+ *
+ * @note std::move() needs to be used to call this constructor.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>::UnrolledList(UnrolledList<T, BlockCapacity>&& moveList) noexcept : UnrolledList()
+{
+    moveList.swap(*this);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ *
+ * @details Clears the list using clear() function.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>::~UnrolledList()
+{
+    clear();
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Adds data to the front of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to add to the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::addFirst(const T& data)
+{
+    emplaceFirst(data);
+}
+
+/**
+ * @brief   Moves data to the front of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to move into the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::addFirst(T&& data)
+{
+    emplaceFirst(std::move(data));
+}
+
+/**
+ * @brief   Adds data to the end of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to add to the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::addLast(const T& data)
+{
+    emplaceLast(data);
+}
+
+/**
+ * @brief   Moves data to the end of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to move into the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::addLast(T&& data)
+{
+    emplaceLast(std::move(data));
+}
+
+/**
+ * @brief   Inserts data into the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to add to the list.
+ * @param index             Index at which to add the data into the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::insert(const T& data, const int index)
+{
+    emplace(index, data);
+}
+
+/**
+ * @brief   Moves data into the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param data              The data you want to move into the list.
+ * @param index             Index at which to add the data into the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::insert(T&& data, const int index)
+{
+    emplace(index, std::move(data));
+}
+
+/**
+ * @brief   Constructs data in place at the front of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @tparam Args             The types of the constructor arguments.
+ * @param args              The arguments forwarded to the constructor of the data.
+ *
+ * @details A new head block is started when the current head block is full.
+ */
+template <typename T, int BlockCapacity>
+template <typename... Args>
+void UnrolledList<T, BlockCapacity>::emplaceFirst(Args&&... args)
+{
+    if(head == nullptr || head->count == BlockCapacity)
+    {
+        T data(std::forward<Args>(args)...);    // The arguments might refer to an element of this list.
+        createBlock(nullptr)->insertAt(0, std::move(data));
+    }
+    else
+        head->insertAt(0, std::forward<Args>(args)...);
+    
+    listSize++;
+}
+
+/**
+ * @brief   Constructs data in place at the end of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @tparam Args             The types of the constructor arguments.
+ * @param args              The arguments forwarded to the constructor of the data.
+ *
+ * @details A new tail block is started when the current tail block is full.
+ */
+template <typename T, int BlockCapacity>
+template <typename... Args>
+void UnrolledList<T, BlockCapacity>::emplaceLast(Args&&... args)
+{
+    if(tail == nullptr || tail->count == BlockCapacity)
+    {
+        T data(std::forward<Args>(args)...);    // The arguments might refer to an element of this list.
+        createBlock(tail)->insertAt(0, std::move(data));
+    }
+    else
+        tail->insertAt(tail->count, std::forward<Args>(args)...);
+    
+    listSize++;
+}
+
+/**
+ * @brief   Constructs data in place at the specified index of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @tparam Args             The types of the constructor arguments.
+ * @param index             Index at which to add the data into the list.
+ * @param args              The arguments forwarded to the constructor of the data.
+ */
+template <typename T, int BlockCapacity>
+template <typename... Args>
+void UnrolledList<T, BlockCapacity>::emplace(const int index, Args&&... args)
+{
+    if(index <= 0)
+        emplaceFirst(std::forward<Args>(args)...);
+    else if(index >= listSize)
+        emplaceLast(std::forward<Args>(args)...);
+    else
+    {
+        int offset;
+        UnrolledBlock<T, BlockCapacity>* block = locate(index, offset);
+        insertInto(block, offset, std::forward<Args>(args)...);
+    }
+}
+
+/**
+ * @brief   Removes data from the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index at which to remove data from the list.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::remove(const int index)
+{
+    // Do nothing if list is empty or index out of range.
+    if(listSize == 0 || index < 0 || index >= listSize)
+        return;
+    
+    int offset;
+    UnrolledBlock<T, BlockCapacity>* block = locate(index, offset);
+    removeFrom(block, offset);
+}
+
+/**
+ * @brief   Clears the entire list and resets all field elements to default.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ *
+ * @details Walks the blocks iteratively. If this list is the only user of its block pool,
+ *          the whole pool is released at once, and the walk is skipped entirely when the
+ *          data is trivially destructible. Otherwise every block is given back to the shared pool.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::clear()
+{
+    // A block only needs its destructor to destroy its elements.
+    nodes.destroyChain(head, &UnrolledBlock<T, BlockCapacity>::next, std::is_trivially_destructible<T>::value);
+    
+    head = nullptr;
+    tail = nullptr;
+    listSize = 0;
+    blockCount = 0;
+}
+
+/**
+ * @brief   Removes and returns the head of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  The removed data.
+ *
+ * @details The data is moved out of the list, not copied.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int BlockCapacity>
+T UnrolledList<T, BlockCapacity>::pop()
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    T popped_data = std::move(head->data()[0]);
+    removeFrom(head, 0);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes and returns data from the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index at which to retrieve and remove data from the list.
+ * @return                  The removed data.
+ *
+ * @details The data is moved out of the list, not copied.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int BlockCapacity>
+T UnrolledList<T, BlockCapacity>::pop(const int index)
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    int offset;
+    UnrolledBlock<T, BlockCapacity>* block = locate(index, offset);
+    T popped_data = std::move(block->data()[offset]);
+    removeFrom(block, offset);
+    
+    return popped_data;
+}
+
+/**
+ * @brief   Removes the head of the list and moves it into the provided variable.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param out               The variable that receives the removed data.
+ * @return                  True if data was removed, false if the list is empty.
+ *
+ * @details Works like pop() but reports an empty list through the return value instead of throwing.
+ */
+template <typename T, int BlockCapacity>
+bool UnrolledList<T, BlockCapacity>::tryPop(T& out)
+{
+    if(head == nullptr)
+        return false;
+    
+    out = std::move(head->data()[0]);
+    removeFrom(head, 0);
+    return true;
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  A reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int BlockCapacity>
+T& UnrolledList<T, BlockCapacity>::peek()
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return head->data()[0];
+}
+
+/**
+ * @brief   Returns, but does not remove, the head of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  A constant reference to the data located at the head of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty when function is called.
+ */
+template <typename T, int BlockCapacity>
+const T& UnrolledList<T, BlockCapacity>::peek() const
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    
+    return head->data()[0];
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index at which to retrieve data from the list.
+ * @return                  A reference to the data located at the specified index of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int BlockCapacity>
+T& UnrolledList<T, BlockCapacity>::peek(const int index)
+{
+    return (*this)[index];
+}
+
+/**
+ * @brief   Returns, but does not remove, data from the list at the specified index.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index at which to retrieve data from the list.
+ * @return                  A constant reference to the data located at the specified index of the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ */
+template <typename T, int BlockCapacity>
+const T& UnrolledList<T, BlockCapacity>::peek(const int index) const
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    int offset;
+    const UnrolledBlock<T, BlockCapacity>* block = locate(index, offset);
+    return block->data()[offset];
+}
+
+/**
+ * @brief   Returns the index of the first occurrence of an element.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param element           The element being searched for in the list.
+ * @return                  The index of the element, or -1 if the element is not in the list.
+ *
+ * @details Every block is a contiguous array, so each block is searched with the vectorized
+ *          kernels from SimdSearch when T is an integer or floating point type.
+ */
+template <typename T, int BlockCapacity>
+int UnrolledList<T, BlockCapacity>::indexOf(const T& element) const
+{
+    int blockStart = 0;
+    for(const UnrolledBlock<T, BlockCapacity>* block = head; block != nullptr; block = block->next)
+    {
+        int offset = SimdSearch::find(block->data(), block->count, element);
+        if(offset != -1)
+            return blockStart + offset;
+        blockStart += block->count;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief   Returns the size of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  The size of the list.
+ */
+template <typename T, int BlockCapacity>
+int UnrolledList<T, BlockCapacity>::size() const
+{
+    return listSize;
+}
+
+/**
+ * @brief   Returns true if the list is empty and false otherwise.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  A boolean flag.
+ */
+template <typename T, int BlockCapacity>
+bool UnrolledList<T, BlockCapacity>::empty() const
+{
+    return listSize == 0;
+}
+
+/**
+ * @brief   Returns the number of blocks in the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  The number of blocks.
+ */
+template <typename T, int BlockCapacity>
+int UnrolledList<T, BlockCapacity>::blocks()
+{
+    return blockCount;
+}
+
+/**
+ * @brief   Returns the block pool used by this list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @return                  The shared block pool.
+ *
+ * @details The returned pool can be passed to the Shared Pool Constructor of another list
+ *          so both lists allocate from, and recycle into, the same pool.
+ */
+template <typename T, int BlockCapacity>
+std::shared_ptr<NodePool<UnrolledBlock<T, BlockCapacity>>> UnrolledList<T, BlockCapacity>::getPool()
+{
+    return nodes.getPool();
+}
+
+/**
+ * @brief   Creates a new, empty block and links it into the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param after             The block after which to link the new block, or nullptr to make it the head.
+ * @return                  The new block.
+ */
+template <typename T, int BlockCapacity>
+UnrolledBlock<T, BlockCapacity>* UnrolledList<T, BlockCapacity>::createBlock(UnrolledBlock<T, BlockCapacity>* after)
+{
+    UnrolledBlock<T, BlockCapacity>* block = nodes.create();
+    block->previous = after;
+    block->next = (after == nullptr) ? head : after->next;
+    
+    if(block->previous == nullptr)
+        head = block;
+    else
+        block->previous->next = block;
+    
+    if(block->next == nullptr)
+        tail = block;
+    else
+        block->next->previous = block;
+    
+    blockCount++;
+    return block;
+}
+
+/**
+ * @brief   Unlinks a block from the list and gives its memory back to the block pool.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param block             The block to destroy.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::destroyBlock(UnrolledBlock<T, BlockCapacity>* block)
+{
+    if(block->previous == nullptr)
+        head = block->next;
+    else
+        block->previous->next = block->next;
+    
+    if(block->next == nullptr)
+        tail = block->previous;
+    else
+        block->next->previous = block->previous;
+    
+    nodes.destroy(block);
+    blockCount--;
+}
+
+/**
+ * @brief   Finds the block that holds the specified index of the list.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index of the element. Must be within range of the list.
+ * @param offset            Receives the position of the element inside the returned block.
+ * @return                  The block holding the element.
+ *
+ * @details Walks block by block from the head or from the tail, whichever is closer to the index.
+ */
+template <typename T, int BlockCapacity>
+UnrolledBlock<T, BlockCapacity>* UnrolledList<T, BlockCapacity>::locate(const int index, int& offset) const
+{
+    UnrolledBlock<T, BlockCapacity>* block;
+    if(index < listSize/2)
+    {
+        int position = index;
+        block = head;
+        while(position >= block->count)
+        {
+            position -= block->count;
+            block = block->next;
+        }
+        offset = position;
+    }
+    else
+    {
+        int position = listSize-1 - index;  // Position counted from the end of the list.
+        block = tail;
+        while(position >= block->count)
+        {
+            position -= block->count;
+            block = block->previous;
+        }
+        offset = block->count-1 - position;
+    }
+    
+    return block;
+}
+
+/**
+ * @brief   Constructs data in place at an offset of a block, splitting the block first if it is full.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @tparam Args             The types of the constructor arguments.
+ * @param block             The block to insert into.
+ * @param offset            The position inside the block.
+ * @param args              The arguments forwarded to the constructor of the data.
+ */
+template <typename T, int BlockCapacity>
+template <typename... Args>
+void UnrolledList<T, BlockCapacity>::insertInto(UnrolledBlock<T, BlockCapacity>* block, int offset, Args&&... args)
+{
+    if(block->count < BlockCapacity)
+    {
+        block->insertAt(offset, std::forward<Args>(args)...);
+        listSize++;
+        return;
+    }
+    
+    T data(std::forward<Args>(args)...);    // The arguments might refer to an element of this list.
+    
+    // Split the full block, moving its second half into a new block.
+    int half = BlockCapacity / 2;
+    UnrolledBlock<T, BlockCapacity>* newBlock = createBlock(block);
+    block->moveTail(half, newBlock);
+    
+    if(offset > half)
+        newBlock->insertAt(offset - half, std::move(data));
+    else
+        block->insertAt(offset, std::move(data));
+    
+    listSize++;
+}
+
+/**
+ * @brief   Removes data at an offset of a block, merging or freeing the block when it runs low.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param block             The block to remove from.
+ * @param offset            The position inside the block.
+ *
+ * @details A block that drops below half its capacity takes over the elements of the next block
+ *          when they fit, so the list stays densely packed.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::removeFrom(UnrolledBlock<T, BlockCapacity>* block, const int offset)
+{
+    block->eraseAt(offset);
+    listSize--;
+    
+    if(block->count == 0)
+        destroyBlock(block);
+    else if(block->count < BlockCapacity/2 && block->next != nullptr && block->count + block->next->count <= BlockCapacity)
+    {
+        UnrolledBlock<T, BlockCapacity>* nextBlock = block->next;
+        nextBlock->moveTail(0, block);
+        destroyBlock(nextBlock);
+    }
+}
+
+/**
+ * @brief   Swaps Linked Lists.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param other             The other linked list with which to swap elements.
+ */
+template <typename T, int BlockCapacity>
+void UnrolledList<T, BlockCapacity>::swap(UnrolledList<T, BlockCapacity>& other)
+{
+    UnrolledBlock<T, BlockCapacity>* tempHead = head;
+    UnrolledBlock<T, BlockCapacity>* tempTail = tail;
+    head = other.head;
+    tail = other.tail;
+    other.head = tempHead;
+    other.tail = tempTail;
+    
+    int tempSize = listSize;
+    listSize = other.listSize;
+    other.listSize = tempSize;
+    
+    int tempCount = blockCount;
+    blockCount = other.blockCount;
+    other.blockCount = tempCount;
+    
+    nodes.swap(other.nodes);
+}
+
+
+// ------------------------------------------------------
+// --------------------- OPERATORS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Subscript operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param index             Index at which to retrieve data reference from the list.
+ * @return                  The reference to the data located at the specified index in the list.
+ *
+ * @throw   std::out_of_range
+ * @warning Throws an Out Of Range exception if the list is empty or index is out of range when function is called.
+ *
+ * @details Works the same way that the [] subscript operator does for arrays.
+ */
+template <typename T, int BlockCapacity>
+T& UnrolledList<T, BlockCapacity>::operator[](const int index)
+{
+    if(head == nullptr)
+        throw std::out_of_range("Linked List is Empty");
+    else if(index < 0 || index >= listSize)
+        throw std::out_of_range("Index is out of range.");
+    
+    int offset;
+    UnrolledBlock<T, BlockCapacity>* block = locate(index, offset);
+    return block->data()[offset];
+}
+
+/**
+ * @brief   Equality comparison operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param compareList       The linked list object with which to compare this linked list object.
+ * @return                  A boolean flag.
+ *
+ * @details Returns true only if the objects are either the same object or both objects
+ *          have the exact same elements in the exact same index locations. If the elements
+ *          are the same but in different index locations, the objects are not considered similar.
+ *          A false flag is returned for all other outcomes.
+ */
+template <typename T, int BlockCapacity>
+bool UnrolledList<T, BlockCapacity>::operator==(const UnrolledList& compareList)
+{
+    if(this == &compareList)
+        return true;
+    else if(listSize != compareList.listSize)
+        return false;
+    
+    // The blocks of the two lists do not have to line up, so compare the runs both blocks have in common.
+    const UnrolledBlock<T, BlockCapacity>* currentBlock = head;
+    const UnrolledBlock<T, BlockCapacity>* compareBlock = compareList.head;
+    int currentOffset = 0;
+    int compareOffset = 0;
+    while(currentBlock != nullptr && compareBlock != nullptr)
+    {
+        int run = std::min(currentBlock->count - currentOffset, compareBlock->count - compareOffset);
+        if(!SimdSearch::equal(currentBlock->data() + currentOffset, compareBlock->data() + compareOffset, run))
+            return false;
+        
+        currentOffset += run;
+        compareOffset += run;
+        if(currentOffset == currentBlock->count)
+        {
+            currentBlock = currentBlock->next;
+            currentOffset = 0;
+        }
+        if(compareOffset == compareBlock->count)
+        {
+            compareBlock = compareBlock->next;
+            compareOffset = 0;
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Copy assignment operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param copyList          The linked list object from which to copy elements.
+ * @return                  A reference to a copied linked list object.
+ *
+ * @details Copies a linked list with the help of the copy constructor and a custom swap function.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>& UnrolledList<T, BlockCapacity>::operator=(const UnrolledList& copyList)
+{
+    UnrolledList<T, BlockCapacity> tempList(copyList);
+    tempList.swap(*this);
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param moveList          The linked list object from which to move elements.
+ * @return                  A reference to a moved linked list object.
+ *
+ * @details Moves linked list elements from the provided list into this linked list object.
+ *          The provided linked list object is empty after the move is complete.
+ *
+ * @note    std::move() needs to be used to call this operator.
+ */
+template <typename T, int BlockCapacity>
+UnrolledList<T, BlockCapacity>& UnrolledList<T, BlockCapacity>::operator=(UnrolledList&& moveList) noexcept
+{
+    if(this == &moveList)   // Make sure this and moveList are not the same object.
+        return *this;
+    
+    this->clear();
+    moveList.swap(*this);
+    return *this;
+}
+
+
+// ------------------------------------------------------
+// --------------- NON-MEMEBER OPERATORS ----------------
+// ------------------------------------------------------
+/**
+ * @brief   Output stream operator.
+ *
+ * @tparam T                Any data type or class.
+ * @tparam BlockCapacity    The maximum number of elements in a block.
+ * @param output            The output stream (usually std::cout).
+ * @param list              The linked list object that will be printed.
+ *
+ * @details Prints the list elements to the specified output stream.
+ *
+ * @note    Any class or data type used with this linked list class MUST implement its
+ *          own operator<< in order for this operator<< to work correctly. All primitive
+ *          data types (int, float, double, char, string, bool) already have this operator
+ *          functionality so no implementation for them is needed. But any custom class that
+ *          is used with this linked list class NEEDS to implement its own operator<<.
+ */
+template <typename T, int BlockCapacity>
+std::ostream& operator<<(std::ostream& output, const UnrolledList<T, BlockCapacity>& list)
+{
+    output << "(";
+    for(const UnrolledBlock<T, BlockCapacity>* block = list.head; block; block = block->next)
+    {
+        for(int i = 0; i < block->count; i++)
+        {
+            if(block != list.head || i > 0)
+                output << ", ";
+            output << block->data()[i];
+        }
+    }
+    return output << ")";
+}
+
+} // namespace DataStructures
+
+#endif /* UnrolledList_hpp */
@@ -0,0 +1,316 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    WorkStealingDeque.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   A generic lock-free work-stealing Deque data structure.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef WorkStealingDeque_hpp
+#define WorkStealingDeque_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace DataStructures
+{
+
+/**
+ * @class   WorkStealingDeque
+ * @brief   A generic lock-free work-stealing Deque class (Chase-Lev deque).
+ * @details This Deque class is templated to use any trivially copyable data type, which is
+ *          usually a pointer to a job. One thread owns the deque and pushes and pops at the
+ *          bottom, like addLast() and pop() of DLinkedList. Any number of other threads can
+ *          steal from the top at the same time. The elements are kept in a contiguous ring
+ *          buffer that doubles in size when it is full. No function throws: an empty deque,
+ *          or a steal that lost a race, is reported by returning false.
+ * @tparam T    Any trivially copyable data type.
+ *
+ * @note    Only the owner thread may call pushBottom() and popBottom().
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque elements must be trivially copyable, store pointers to larger jobs.");
+    
+public:
+    // ---------- CONSTRUCTORS ----------
+    WorkStealingDeque();
+    explicit WorkStealingDeque(const int initialCapacity);
+    WorkStealingDeque(const WorkStealingDeque<T>& copyDeque) = delete;
+    ~WorkStealingDeque();
+    
+    // ----------- FUNCTIONS ------------
+    void pushBottom(const T& data);
+    bool popBottom(T& out);
+    bool steal(T& out);
+    int size();
+    bool empty();
+    int capacity();
+    
+    // ----------- OPERATORS ------------
+    WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>& copyDeque) = delete;
+    
+private:
+    /**
+     * @struct  Ring
+     * @brief   A ring buffer whose capacity is a power of two.
+     * @details A ring that was outgrown is kept until the deque is destroyed, because a thief
+     *          may still be reading from it. Every ring is half the size of the next one, so
+     *          all the old rings together never take more memory than the current ring.
+     */
+    struct Ring
+    {
+        std::int64_t mask;          /**< The capacity minus one. */
+        std::atomic<T>* elements;   /**< The elements. */
+        Ring* previous;             /**< The ring this ring replaced. */
+        
+        /** Capacity Constructor. */
+        Ring(const std::int64_t ringCapacity, Ring* previous) : mask(ringCapacity - 1), elements(new std::atomic<T>[ringCapacity]), previous(previous) {}
+        /** Class Destructor. */
+        ~Ring() { delete[] elements; }
+        
+        /** Returns the element at a position. Positions wrap around the ring. */
+        T get(const std::int64_t position) const { return elements[position & mask].load(std::memory_order_relaxed); }
+        /** Stores the element at a position. Positions wrap around the ring. */
+        void put(const std::int64_t position, const T& data) { elements[position & mask].store(data, std::memory_order_relaxed); }
+    };
+    
+    // ------------- FIELDS -------------
+    alignas(64) std::atomic<std::int64_t> top;      /**< The position thieves steal from. Only ever grows. */
+    alignas(64) std::atomic<std::int64_t> bottom;   /**< One past the position the owner pops from. */
+    std::atomic<Ring*> ring;                        /**< The current ring buffer. */
+    
+    // ----------- CONSTANTS ------------
+    static const int DEFAULT_CAPACITY = 64;     /**< The capacity of the first ring buffer. */
+    
+    // ----------- FUNCTIONS ------------
+    Ring* grow(Ring* current, const std::int64_t first, const std::int64_t last);
+};
+
+
+// **************************************************************************
+// **************************************************************************
+// ****!!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! IMPLEMENTATION !!!! *****
+// **************************************************************************
+// **************************************************************************
+
+// ------------------------------------------------------
+// -------------------- CONSTRUCTORS --------------------
+// ------------------------------------------------------
+/**
+ * @brief   Default Constructor.
+ *
+ * @tparam T    Any trivially copyable data type.
+ *
+ * @details Initializes an empty deque with room for DEFAULT_CAPACITY elements.
+ */
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque() : WorkStealingDeque(DEFAULT_CAPACITY) {}
+
+/**
+ * @brief   Capacity Constructor.
+ *
+ * @tparam T                Any trivially copyable data type.
+ * @param initialCapacity   The number of elements the deque can hold before it has to grow.
+ *                          Rounded up to a power of two.
+ */
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(const int initialCapacity) : top(0), bottom(0), ring(nullptr)
+{
+    std::int64_t ringCapacity = 1;
+    while(ringCapacity < initialCapacity)
+        ringCapacity *= 2;
+    
+    ring.store(new Ring(ringCapacity, nullptr), std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Class Destructor.
+ *
+ * @tparam T    Any trivially copyable data type.
+ *
+ * @details Deletes the current ring buffer and every ring buffer it replaced.
+ *
+ * @warning No other thread may use the deque while it is destroyed.
+ */
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque()
+{
+    Ring* current = ring.load(std::memory_order_acquire);
+    while(current != nullptr)
+    {
+        Ring* previous = current->previous;
+        delete current;
+        current = previous;
+    }
+}
+
+
+// ------------------------------------------------------
+// --------------------- FUNCTIONS ----------------------
+// ------------------------------------------------------
+/**
+ * @brief   Pushes a new element onto the bottom of the deque.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @param data  The element that will be pushed.
+ *
+ * @details The ring buffer doubles in size when it is full.
+ *
+ * @warning Only the owner thread may call this function.
+ */
+template <typename T>
+void WorkStealingDeque<T>::pushBottom(const T& data)
+{
+    std::int64_t last = bottom.load(std::memory_order_relaxed);
+    std::int64_t first = top.load(std::memory_order_acquire);
+    Ring* current = ring.load(std::memory_order_relaxed);
+    if(last - first > current->mask)    // The ring is full.
+        current = grow(current, first, last);
+    
+    current->put(last, data);
+    bottom.store(last + 1, std::memory_order_release);
+}
+
+/**
+ * @brief   Pops the element at the bottom of the deque without throwing.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @param out   Receives the element that was at the bottom of the deque.
+ * @return      True if an element was popped, false if the deque was empty.
+ *
+ * @details The bottom is moved up before the top is read, so a thief that reads the top at the
+ *          same time sees one element less. Only the last element can be wanted by both the
+ *          owner and a thief, and for that one they race on the top with a compare-and-swap.
+ *
+ * @warning Only the owner thread may call this function.
+ */
+template <typename T>
+bool WorkStealingDeque<T>::popBottom(T& out)
+{
+    std::int64_t last = bottom.load(std::memory_order_relaxed) - 1;
+    Ring* current = ring.load(std::memory_order_relaxed);
+    bottom.store(last, std::memory_order_seq_cst);
+    std::int64_t first = top.load(std::memory_order_seq_cst);
+    
+    if(first > last)    // The deque was empty.
+    {
+        bottom.store(last + 1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    out = current->get(last);
+    if(first == last)   // The last element, a thief may be stealing it right now.
+    {
+        bool won = top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(last + 1, std::memory_order_relaxed);
+        return won;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief   Steals the element at the top of the deque without throwing.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @param out   Receives the element that was at the top of the deque.
+ * @return      True if an element was stolen, false if the deque was empty or
+ *              another thread took the element first.
+ *
+ * @details The element is read before the top is moved past it with a compare-and-swap,
+ *          and it only counts as stolen if that swap succeeds.
+ *
+ * @note    Any thread may call this function.
+ */
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& out)
+{
+    std::int64_t first = top.load(std::memory_order_seq_cst);
+    std::int64_t last = bottom.load(std::memory_order_seq_cst);
+    if(first >= last)   // The deque is empty.
+        return false;
+    
+    T data = ring.load(std::memory_order_acquire)->get(first);
+    if(!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+    
+    out = data;
+    return true;
+}
+
+/**
+ * @brief   Returns the size of the deque.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @return      The size of the deque.
+ *
+ * @note    The size is only approximate while other threads push, pop or steal.
+ */
+template <typename T>
+int WorkStealingDeque<T>::size()
+{
+    std::int64_t last = bottom.load(std::memory_order_relaxed);
+    std::int64_t first = top.load(std::memory_order_relaxed);
+    return (last > first) ? (int)(last - first) : 0;
+}
+
+/**
+ * @brief   Returns true if the deque is empty and false otherwise.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @return      A boolean flag.
+ *
+ * @note    Other threads may push, pop or steal right after this returns.
+ */
+template <typename T>
+bool WorkStealingDeque<T>::empty()
+{
+    return size() == 0;
+}
+
+/**
+ * @brief   Returns the number of elements the deque can hold before it has to grow.
+ *
+ * @tparam T    Any trivially copyable data type.
+ * @return      The capacity of the deque.
+ */
+template <typename T>
+int WorkStealingDeque<T>::capacity()
+{
+    return (int)(ring.load(std::memory_order_relaxed)->mask + 1);
+}
+
+/**
+ * @brief   Replaces the ring buffer with one of twice the size.
+ *
+ * @tparam T        Any trivially copyable data type.
+ * @param current   The current ring buffer.
+ * @param first     The top position.
+ * @param last      The bottom position.
+ * @return          The new ring buffer.
+ *
+ * @details The elements keep their positions, so thieves that read the old ring
+ *          and thieves that read the new ring get the same element for the same position.
+ */
+template <typename T>
+typename WorkStealingDeque<T>::Ring* WorkStealingDeque<T>::grow(Ring* current, const std::int64_t first, const std::int64_t last)
+{
+    Ring* larger = new Ring(2 * (current->mask + 1), current);
+    for(std::int64_t position = first; position < last; position++)
+        larger->put(position, current->get(position));
+    
+    ring.store(larger, std::memory_order_release);
+    return larger;
+}
+
+} // namespace DataStructures
+
+#endif /* WorkStealingDeque_hpp */
@@ -0,0 +1,163 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    BenchmarkElements.hpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   The element types and inputs that every benchmark of the data structures shares.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#ifndef BenchmarkElements_hpp
+#define BenchmarkElements_hpp
+
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <benchmark/benchmark.h>
+
+namespace DataStructures
+{
+namespace Benchmarks
+{
+
+/**
+ * @struct  LargePod
+ * @brief   A 256 byte plain old data element, for measuring the cost of copying large elements.
+ * @details Two elements are compared by their key only.
+ */
+struct LargePod
+{
+    int key;            /**< Identifies the element. */
+    int payload[63];    /**< Filler that makes the element 256 bytes large. */
+};
+
+/** Equality comparison operator, compares the keys. */
+inline bool operator==(const LargePod& first, const LargePod& second) { return first.key == second.key; }
+/** Inequality comparison operator, compares the keys. */
+inline bool operator!=(const LargePod& first, const LargePod& second) { return first.key != second.key; }
+/** Less than comparison operator, compares the keys. */
+inline bool operator<(const LargePod& first, const LargePod& second) { return first.key < second.key; }
+/** Output stream operator, prints the key. */
+inline std::ostream& operator<<(std::ostream& output, const LargePod& element) { return output << element.key; }
+
+// ----------- CONSTANTS ------------
+const int BATCH_SIZE = 16;  /**< The number of elements a benchmark changes before it undoes the changes untimed. */
+
+/**
+ * @brief   Creates the element with the specified value.
+ *
+ * @tparam T    int, std::string or LargePod.
+ * @param value The value of the element. Different values make different elements.
+ * @return      The element.
+ */
+template <typename T>
+T makeElement(const int value);
+
+/** Creates an int element. */
+template <>
+inline int makeElement<int>(const int value)
+{
+    return value;
+}
+
+/** Creates a string element, too long for the small string optimization. */
+template <>
+inline std::string makeElement<std::string>(const int value)
+{
+    return "benchmark element number " + std::to_string(value);
+}
+
+/** Creates a LargePod element with its whole payload written. */
+template <>
+inline LargePod makeElement<LargePod>(const int value)
+{
+    LargePod element;
+    element.key = value;
+    for(int i = 0; i < 63; i++)
+        element.payload[i] = value + i;
+    
+    return element;
+}
+
+/**
+ * @brief   Creates a number of different elements.
+ *
+ * @tparam T    int, std::string or LargePod.
+ * @param count The number of elements.
+ * @return      The elements with the values 0 to count-1, in order.
+ */
+template <typename T>
+std::vector<T> makeElements(const int count)
+{
+    std::vector<T> elements;
+    elements.reserve(count);
+    for(int i = 0; i < count; i++)
+        elements.push_back(makeElement<T>(i));
+    
+    return elements;
+}
+
+/**
+ * @brief   Creates a repeatable sequence of random indices.
+ *
+ * @param count The number of indices.
+ * @param range The number of valid indices, so every index is in [0, range).
+ * @return      The indices. The same arguments always give the same indices.
+ */
+inline std::vector<int> randomIndices(const int count, const int range)
+{
+    std::mt19937 generator(20261014);
+    std::uniform_int_distribution<int> distribution(0, range - 1);
+    std::vector<int> indices;
+    indices.reserve(count);
+    for(int i = 0; i < count; i++)
+        indices.push_back(distribution(generator));
+    
+    return indices;
+}
+
+/**
+ * @brief   Runs a benchmark with data structures of 8 up to 32768 elements.
+ *
+ * @param benchmark The benchmark to configure.
+ */
+inline void containerSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(8)->Range(8, 1 << 15);
+}
+
+/**
+ * @brief   Runs a benchmark with data structures of 8 up to 4096 elements.
+ *
+ * @param benchmark The benchmark to configure.
+ *
+ * @details For the operations that take linear time for every element, like inserting into
+ *          an ArrayBinaryTree, which searches the whole tree for a duplicate first.
+ */
+inline void smallContainerSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(8)->Range(8, 1 << 12);
+}
+
+/**
+ * @brief   Runs a benchmark with data structures of 4096 up to 1048576 elements.
+ *
+ * @param benchmark The benchmark to configure.
+ *
+ * @details For the operations that can be split across threads, which only pays off for large
+ *          data structures.
+ */
+inline void largeContainerSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+}
+
+} // namespace Benchmarks
+} // namespace DataStructures
+
+#endif /* BenchmarkElements_hpp */
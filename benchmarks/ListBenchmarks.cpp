@@ -0,0 +1,330 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    ListBenchmarks.cpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   Benchmarks of the linked list operations, for SLinkedList, DLinkedList and UnrolledList.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#include <string>
+#include <vector>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include "BenchmarkElements.hpp"
+#include "SLinkedList.hpp"
+#include "DLinkedList.hpp"
+#include "UnrolledList.hpp"
+
+namespace DataStructures
+{
+namespace Benchmarks
+{
+
+/**
+ * @brief   Fills a list with elements, using addLast().
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param list      The list to fill.
+ * @param elements  The elements, in the order they will be in the list.
+ * @param count     The number of elements to add.
+ */
+template <typename List, typename T>
+void fillList(List& list, const std::vector<T>& elements, const int count)
+{
+    for(int i = 0; i < count; i++)
+        list.addLast(elements[i]);
+}
+
+/**
+ * @brief   Builds a list of range(0) elements with addFirst() and tears it down again.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename List, typename T>
+void listAddFirst(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    for(auto _ : state)
+    {
+        List list;
+        for(int i = 0; i < size; i++)
+            list.addFirst(elements[i]);
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Builds a list of range(0) elements with addLast() and tears it down again.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename List, typename T>
+void listAddLast(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    for(auto _ : state)
+    {
+        List list;
+        fillList(list, elements, size);
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Inserts BATCH_SIZE elements into the middle of a list of range(0) elements.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The inserted elements are removed again while the timer is paused.
+ */
+template <typename List, typename T>
+void listInsert(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size + BATCH_SIZE);
+    List list;
+    fillList(list, elements, size);
+    for(auto _ : state)
+    {
+        for(int i = 0; i < BATCH_SIZE; i++)
+            list.insert(elements[size + i], size / 2);
+        
+        state.PauseTiming();
+        for(int i = 0; i < BATCH_SIZE; i++)
+            list.remove(size / 2);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+/**
+ * @brief   Removes BATCH_SIZE elements from the middle of a list of range(0) elements.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The removed elements are inserted again while the timer is paused.
+ */
+template <typename List, typename T>
+void listRemove(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size + BATCH_SIZE);
+    List list;
+    fillList(list, elements, size + BATCH_SIZE);
+    for(auto _ : state)
+    {
+        for(int i = 0; i < BATCH_SIZE; i++)
+            list.remove(size / 2);
+        
+        state.PauseTiming();
+        for(int i = 0; i < BATCH_SIZE; i++)
+            list.insert(elements[size + i], size / 2);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+/**
+ * @brief   Pops BATCH_SIZE elements off the head of a list of range(0) elements.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The popped elements are added again while the timer is paused.
+ */
+template <typename List, typename T>
+void listPop(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size + BATCH_SIZE);
+    List list;
+    fillList(list, elements, size + BATCH_SIZE);
+    for(auto _ : state)
+    {
+        for(int i = 0; i < BATCH_SIZE; i++)
+            benchmark::DoNotOptimize(list.pop());
+        
+        state.PauseTiming();
+        for(int i = 0; i < BATCH_SIZE; i++)
+            list.addFirst(elements[i]);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+/**
+ * @brief   Peeks at the head of a list of range(0) elements.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename List, typename T>
+void listPeek(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    List list;
+    fillList(list, elements, size);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(list.peek());
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Reads random elements of a list of range(0) elements with operator[].
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename List, typename T>
+void listSubscript(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024, size);
+    List list;
+    fillList(list, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(list[indices[next]]);
+        next = (next + 1) % (int)indices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Copy constructs a list of range(0) elements.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The copy is torn down again inside the timed region.
+ */
+template <typename List, typename T>
+void listCopy(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    List list;
+    fillList(list, elements, size);
+    for(auto _ : state)
+    {
+        List copy(list);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Move constructs a list of range(0) elements, and move assigns it back.
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename List, typename T>
+void listMove(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    List list;
+    fillList(list, elements, size);
+    for(auto _ : state)
+    {
+        List moved(std::move(list));
+        benchmark::DoNotOptimize(moved);
+        list = std::move(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Sorts a shuffled list of range(0) elements with sort().
+ *
+ * @tparam List     The list type.
+ * @tparam T        The element type.
+ * @tparam Parallel True to sort with ExecutionPolicy::parallel(), false to sort on the calling thread.
+ * @param state     The benchmark state.
+ *
+ * @details The list is filled with the shuffled elements again while the timer is paused.
+ */
+template <typename List, typename T, bool Parallel>
+void listSort(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::mt19937 generator(20261014);
+    std::shuffle(elements.begin(), elements.end(), generator);
+    ExecutionPolicy policy = Parallel ? ExecutionPolicy::parallel() : ExecutionPolicy::sequential();
+    List list;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        list.clear();
+        fillList(list, elements, size);
+        state.ResumeTiming();
+        
+        list.sort(policy);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/** Registers every list benchmark for one list type and element type. */
+#define LIST_BENCHMARKS(List, T)                                                \
+    BENCHMARK_TEMPLATE(listAddFirst, List<T>, T)->Apply(containerSizes);        \
+    BENCHMARK_TEMPLATE(listAddLast, List<T>, T)->Apply(containerSizes);         \
+    BENCHMARK_TEMPLATE(listInsert, List<T>, T)->Apply(containerSizes);          \
+    BENCHMARK_TEMPLATE(listRemove, List<T>, T)->Apply(containerSizes);          \
+    BENCHMARK_TEMPLATE(listPop, List<T>, T)->Apply(containerSizes);             \
+    BENCHMARK_TEMPLATE(listPeek, List<T>, T)->Apply(containerSizes);            \
+    BENCHMARK_TEMPLATE(listSubscript, List<T>, T)->Apply(containerSizes);       \
+    BENCHMARK_TEMPLATE(listCopy, List<T>, T)->Apply(containerSizes);            \
+    BENCHMARK_TEMPLATE(listMove, List<T>, T)->Apply(containerSizes)
+
+LIST_BENCHMARKS(SLinkedList, int);
+LIST_BENCHMARKS(SLinkedList, std::string);
+LIST_BENCHMARKS(SLinkedList, LargePod);
+LIST_BENCHMARKS(DLinkedList, int);
+LIST_BENCHMARKS(DLinkedList, std::string);
+LIST_BENCHMARKS(DLinkedList, LargePod);
+LIST_BENCHMARKS(UnrolledList, int);
+LIST_BENCHMARKS(UnrolledList, std::string);
+LIST_BENCHMARKS(UnrolledList, LargePod);
+
+/** Registers the sort benchmarks for one list type and element type. */
+#define SORT_BENCHMARKS(List, T)                                                    \
+    BENCHMARK_TEMPLATE(listSort, List<T>, T, false)->Apply(largeContainerSizes);    \
+    BENCHMARK_TEMPLATE(listSort, List<T>, T, true)->Apply(largeContainerSizes)
+
+SORT_BENCHMARKS(SLinkedList, int);
+SORT_BENCHMARKS(SLinkedList, std::string);
+SORT_BENCHMARKS(DLinkedList, int);
+SORT_BENCHMARKS(DLinkedList, std::string);
+
+} // namespace Benchmarks
+} // namespace DataStructures
@@ -0,0 +1,174 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    StackBenchmarks.cpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   Benchmarks of the stack operations, for Stack and ArrayStack.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <benchmark/benchmark.h>
+#include "BenchmarkElements.hpp"
+#include "Stack.hpp"
+#include "ArrayStack.hpp"
+
+namespace DataStructures
+{
+namespace Benchmarks
+{
+
+/**
+ * @brief   Pushes elements onto a stack.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param stack     The stack to fill.
+ * @param elements  The elements, from the bottom of the stack to the top.
+ * @param count     The number of elements to push.
+ */
+template <typename Stack, typename T>
+void fillStack(Stack& stack, const std::vector<T>& elements, const int count)
+{
+    for(int i = 0; i < count; i++)
+        stack.push(elements[i]);
+}
+
+/**
+ * @brief   Builds a stack of range(0) elements with push() and tears it down again.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Stack, typename T>
+void stackPush(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    for(auto _ : state)
+    {
+        Stack stack;
+        fillStack(stack, elements, size);
+        benchmark::DoNotOptimize(stack);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Pops every element off a stack of range(0) elements.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The stack is filled again while the timer is paused.
+ */
+template <typename Stack, typename T>
+void stackPop(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Stack stack;
+    fillStack(stack, elements, size);
+    for(auto _ : state)
+    {
+        for(int i = 0; i < size; i++)
+            benchmark::DoNotOptimize(stack.pop());
+        
+        state.PauseTiming();
+        fillStack(stack, elements, size);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Peeks at the top of a stack of range(0) elements.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Stack, typename T>
+void stackPeek(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Stack stack;
+    fillStack(stack, elements, size);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(stack.peek());
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Copy constructs a stack of range(0) elements.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The copy is torn down again inside the timed region.
+ */
+template <typename Stack, typename T>
+void stackCopy(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Stack stack;
+    fillStack(stack, elements, size);
+    for(auto _ : state)
+    {
+        Stack copy(stack);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Move constructs a stack of range(0) elements, and move assigns it back.
+ *
+ * @tparam Stack    The stack type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Stack, typename T>
+void stackMove(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Stack stack;
+    fillStack(stack, elements, size);
+    for(auto _ : state)
+    {
+        Stack moved(std::move(stack));
+        benchmark::DoNotOptimize(moved);
+        stack = std::move(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/** Registers every stack benchmark for one stack type and element type. */
+#define STACK_BENCHMARKS(Stack, T)                                              \
+    BENCHMARK_TEMPLATE(stackPush, Stack<T>, T)->Apply(containerSizes);          \
+    BENCHMARK_TEMPLATE(stackPop, Stack<T>, T)->Apply(containerSizes);           \
+    BENCHMARK_TEMPLATE(stackPeek, Stack<T>, T)->Apply(containerSizes);          \
+    BENCHMARK_TEMPLATE(stackCopy, Stack<T>, T)->Apply(containerSizes);          \
+    BENCHMARK_TEMPLATE(stackMove, Stack<T>, T)->Apply(containerSizes)
+
+STACK_BENCHMARKS(Stack, int);
+STACK_BENCHMARKS(Stack, std::string);
+STACK_BENCHMARKS(Stack, LargePod);
+STACK_BENCHMARKS(ArrayStack, int);
+STACK_BENCHMARKS(ArrayStack, std::string);
+STACK_BENCHMARKS(ArrayStack, LargePod);
+
+} // namespace Benchmarks
+} // namespace DataStructures
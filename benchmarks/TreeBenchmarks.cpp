@@ -0,0 +1,284 @@
+/**
+ * Copyright © 2026 Al Timofeyev. All rights reserved.
+ * @file    TreeBenchmarks.cpp
+ *
+ * @author  Al Timofeyev
+ * @date    October 14, 2026
+ * @brief   Benchmarks of the binary tree operations, for BinaryTree and ArrayBinaryTree.
+ *
+ * Version: 1.0
+ * Modified By:
+ * Modified Date:
+ * *********************************************************/
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <benchmark/benchmark.h>
+#include "BenchmarkElements.hpp"
+#include "BinaryTree.hpp"
+#include "ArrayBinaryTree.hpp"
+
+namespace DataStructures
+{
+namespace Benchmarks
+{
+
+/**
+ * @brief   Inserts elements into a tree.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param tree      The tree to fill.
+ * @param elements  The elements, in level order.
+ * @param count     The number of elements to insert.
+ */
+template <typename Tree, typename T>
+void fillTree(Tree& tree, const std::vector<T>& elements, const int count)
+{
+    for(int i = 0; i < count; i++)
+        tree.insert(elements[i]);
+}
+
+/**
+ * @brief   Builds a tree of range(0) elements with insert() and tears it down again.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeInsert(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    for(auto _ : state)
+    {
+        Tree tree;
+        fillTree(tree, elements, size);
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Searches a tree of range(0) elements breadth first for random elements in the tree.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeBfsearch(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024, size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.bfsearch(elements[indices[next]]));
+        next = (next + 1) % (int)indices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Searches a tree of range(0) elements depth first for random elements in the tree.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeDfsearch(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024, size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.dfsearch(elements[indices[next]]));
+        next = (next + 1) % (int)indices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Removes BATCH_SIZE random elements from a tree of range(0) elements.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The removed elements are inserted again while the timer is paused.
+ *          Every round removes the elements of the next batch of random indices, so the
+ *          elements that are removed end up all over the tree. In the smallest trees a batch
+ *          repeats some indices, and removing an element that is already removed does nothing.
+ */
+template <typename Tree, typename T>
+void treeRemove(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024 * BATCH_SIZE, size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < BATCH_SIZE; i++)
+            tree.remove(elements[indices[next + i]]);
+        
+        state.PauseTiming();
+        for(int i = 0; i < BATCH_SIZE; i++)
+            tree.insert(elements[indices[next + i]]);
+        next = (next + BATCH_SIZE) % (int)indices.size();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+/**
+ * @brief   Calculates the depth of random elements in a tree of range(0) elements.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeDepth(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024, size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.depth(elements[indices[next]]));
+        next = (next + 1) % (int)indices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Calculates the height of random elements in a tree of range(0) elements.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeHeight(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    std::vector<int> indices = randomIndices(1024, size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    int next = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.height(elements[indices[next]]));
+        next = (next + 1) % (int)indices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief   Inverts a tree of range(0) elements.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeInvert(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    for(auto _ : state)
+    {
+        tree.invertTree();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Copy constructs a tree of range(0) elements.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ *
+ * @details The copy is torn down again inside the timed region.
+ */
+template <typename Tree, typename T>
+void treeCopy(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    for(auto _ : state)
+    {
+        Tree copy(tree);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/**
+ * @brief   Move constructs a tree of range(0) elements, and move assigns it back.
+ *
+ * @tparam Tree     The tree type.
+ * @tparam T        The element type.
+ * @param state     The benchmark state.
+ */
+template <typename Tree, typename T>
+void treeMove(benchmark::State& state)
+{
+    const int size = (int)state.range(0);
+    std::vector<T> elements = makeElements<T>(size);
+    Tree tree;
+    fillTree(tree, elements, size);
+    for(auto _ : state)
+    {
+        Tree moved(std::move(tree));
+        benchmark::DoNotOptimize(moved);
+        tree = std::move(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/** Registers every tree benchmark for one tree type and element type. */
+#define TREE_BENCHMARKS(Tree, T)                                                \
+    BENCHMARK_TEMPLATE(treeInsert, Tree<T>, T)->Apply(smallContainerSizes);     \
+    BENCHMARK_TEMPLATE(treeBfsearch, Tree<T>, T)->Apply(smallContainerSizes);   \
+    BENCHMARK_TEMPLATE(treeDfsearch, Tree<T>, T)->Apply(smallContainerSizes);   \
+    BENCHMARK_TEMPLATE(treeRemove, Tree<T>, T)->Apply(smallContainerSizes);     \
+    BENCHMARK_TEMPLATE(treeDepth, Tree<T>, T)->Apply(smallContainerSizes);      \
+    BENCHMARK_TEMPLATE(treeHeight, Tree<T>, T)->Apply(smallContainerSizes);     \
+    BENCHMARK_TEMPLATE(treeInvert, Tree<T>, T)->Apply(smallContainerSizes);     \
+    BENCHMARK_TEMPLATE(treeCopy, Tree<T>, T)->Apply(smallContainerSizes);       \
+    BENCHMARK_TEMPLATE(treeMove, Tree<T>, T)->Apply(smallContainerSizes)
+
+TREE_BENCHMARKS(BinaryTree, int);
+TREE_BENCHMARKS(BinaryTree, std::string);
+TREE_BENCHMARKS(BinaryTree, LargePod);
+TREE_BENCHMARKS(ArrayBinaryTree, int);
+TREE_BENCHMARKS(ArrayBinaryTree, std::string);
+TREE_BENCHMARKS(ArrayBinaryTree, LargePod);
+
+} // namespace Benchmarks
+} // namespace DataStructures